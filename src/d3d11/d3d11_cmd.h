@@ -2,6 +2,10 @@
 
 #include "d3d11_include.h"
 
+#include "../dxvk/dxvk_buffer.h"
+#include "../dxvk/dxvk_image.h"
+#include "../dxvk/dxvk_sampler.h"
+
 namespace dxvk {
 
   /**
@@ -16,6 +20,7 @@ namespace dxvk {
     DrawIndirectIndexed,
     Draw,
     DrawIndexed,
+    BufferRename,
   };
 
 
@@ -32,4 +37,58 @@ namespace dxvk {
     uint32_t            stride;
   };
 
+
+  /**
+   * \brief Buffer rename data
+   *
+   * Stores the buffer and its newly allocated backing
+   * storage. Consecutive renames, e.g. from several
+   * constant buffers being updated before a draw,
+   * are recorded as a single command.
+   */
+  struct D3D11CmdBufferRename {
+    Rc<DxvkBuffer>              buffer;
+    Rc<DxvkResourceAllocation>  storage;
+  };
+
+
+  /**
+   * \brief Constant buffer binding data
+   *
+   * Stores the backend slot and buffer slice for one
+   * constant buffer when flushing several dirty slots
+   * of a shader stage with a single command.
+   */
+  struct D3D11CmdConstantBufferBinding {
+    uint32_t            slot;
+    DxvkBufferSlice     slice;
+  };
+
+
+  /**
+   * \brief Sampler binding data
+   *
+   * Stores the backend slot and sampler object for
+   * one sampler when flushing several dirty slots
+   * of a shader stage with a single command.
+   */
+  struct D3D11CmdSamplerBinding {
+    uint32_t            slot;
+    Rc<DxvkSampler>     sampler;
+  };
+
+
+  /**
+   * \brief Shader resource binding data
+   *
+   * Stores the backend slot and view for one shader
+   * resource. At most one of the two views is set,
+   * if neither is set, the slot will be unbound.
+   */
+  struct D3D11CmdShaderResourceBinding {
+    uint32_t            slot;
+    Rc<DxvkImageView>   imageView;
+    Rc<DxvkBufferView>  bufferView;
+  };
+
 }
@@ -113,6 +113,14 @@ namespace dxvk {
           D3D11_RESOURCE_DIMENSION ResourceType,
           UINT                Subresource,
           uint64_t            ChunkId) {
+    if (m_chunkResourcesId != ChunkId) {
+      m_chunkResources.clear();
+      m_chunkResourcesId = ChunkId;
+    }
+
+    if (!m_chunkResources.insert({ pResource, Subresource }).second)
+      return;
+
     TrackedResource entry;
     entry.ref = D3D11ResourceRef(pResource, Subresource, ResourceType);
     entry.chunkId = ChunkId;
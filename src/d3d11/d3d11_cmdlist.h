@@ -1,6 +1,7 @@
 #pragma once
 
 #include <functional>
+#include <unordered_set>
 
 #include "d3d11_context.h"
 
@@ -49,12 +50,36 @@ namespace dxvk {
       uint64_t          chunkId;
     };
 
+    struct TrackedResourceKey {
+      ID3D11Resource*   resource;
+      UINT              subresource;
+
+      bool eq(const TrackedResourceKey& other) const {
+        return resource    == other.resource
+            && subresource == other.subresource;
+      }
+
+      size_t hash() const {
+        DxvkHashState hash;
+        hash.add(reinterpret_cast<uintptr_t>(resource));
+        hash.add(subresource);
+        return hash;
+      }
+    };
+
     UINT m_contextFlags = 0u;
 
     std::vector<DxvkCsChunkRef>         m_chunks;
     std::vector<Com<D3D11Query, false>> m_queries;
     std::vector<TrackedResource>        m_resources;
 
+    // Resources already tracked for the most recent chunk. Tracking
+    // the same resource more than once per chunk has no effect.
+    std::unordered_set<
+      TrackedResourceKey,
+      DxvkHash, DxvkEq>                 m_chunkResources;
+    uint64_t                            m_chunkResourcesId = 0ull;
+
     D3DDestructionNotifier              m_destructionNotifier;
 
     void TrackResourceSequenceNumber(
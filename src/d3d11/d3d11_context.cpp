@@ -3144,11 +3144,34 @@ namespace dxvk {
     const auto& state = m_state.cbv[Stage];
     DirtyMask.cbvMask -= bindMask;
 
-    for (uint32_t slot : bit::BitMask(bindMask)) {
+    if (!(bindMask & (bindMask - 1u))) {
+      uint32_t slot = bit::tzcnt(bindMask);
       const auto& cbv = state.buffers[slot];
 
       BindConstantBuffer(Stage, slot, cbv.buffer.ptr(),
         cbv.constantOffset, cbv.constantBound);
+      return;
+    }
+
+    // Forward all dirty slots of the stage with one single
+    // command in order to reduce CS chunk usage per draw
+    EmitCsCmd<D3D11CmdConstantBufferBinding>(D3D11CmdType::None, bit::popcnt(bindMask), [
+      cStage = GetShaderStage(Stage)
+    ] (DxvkContext* ctx, D3D11CmdConstantBufferBinding* bindings, size_t count) {
+      for (size_t i = 0; i < count; i++)
+        ctx->bindUniformBuffer(cStage, bindings[i].slot, Forwarder::move(bindings[i].slice));
+    });
+
+    uint32_t index = 0u;
+
+    for (uint32_t slot : bit::BitMask(bindMask)) {
+      const auto& cbv = state.buffers[slot];
+
+      auto binding = new (m_csData->at(index++)) D3D11CmdConstantBufferBinding();
+      binding->slot = computeConstantBufferBinding(Stage, slot);
+
+      if (cbv.buffer != nullptr)
+        binding->slice = cbv.buffer->GetBufferSlice(16u * cbv.constantOffset, 16u * cbv.constantBound);
     }
   }
 
@@ -3167,8 +3190,28 @@ namespace dxvk {
     const auto& state = m_state.samplers[Stage];
     DirtyMask.samplerMask -= bindMask;
 
-    for (uint32_t slot : bit::BitMask(bindMask))
+    if (!(bindMask & (bindMask - 1u))) {
+      uint32_t slot = bit::tzcnt(bindMask);
       BindSampler(Stage, slot, state.samplers[slot]);
+      return;
+    }
+
+    EmitCsCmd<D3D11CmdSamplerBinding>(D3D11CmdType::None, bit::popcnt(bindMask), [
+      cStage = GetShaderStage(Stage)
+    ] (DxvkContext* ctx, D3D11CmdSamplerBinding* bindings, size_t count) {
+      for (size_t i = 0; i < count; i++)
+        ctx->bindResourceSampler(cStage, bindings[i].slot, Forwarder::move(bindings[i].sampler));
+    });
+
+    uint32_t index = 0u;
+
+    for (uint32_t slot : bit::BitMask(bindMask)) {
+      auto binding = new (m_csData->at(index++)) D3D11CmdSamplerBinding();
+      binding->slot = computeSamplerBinding(Stage, slot);
+
+      if (state.samplers[slot] != nullptr)
+        binding->sampler = state.samplers[slot]->GetDXVKSampler();
+    }
   }
 
 
@@ -3186,11 +3229,41 @@ namespace dxvk {
       if (!bindMask)
         continue;
 
-    // Need to clear dirty bits before binding
+      // Need to clear dirty bits before binding
       DirtyMask.srvMask[maskIndex] -= bindMask;
 
-      for (uint32_t slot : bit::BitMask(bindMask))
+      if (!(bindMask & (bindMask - 1u))) {
+        uint32_t slot = bit::tzcnt(bindMask);
         BindShaderResource(Stage, slot + i, state.views[slot + i].ptr());
+        continue;
+      }
+
+      EmitCsCmd<D3D11CmdShaderResourceBinding>(D3D11CmdType::None, bit::popcnt(bindMask), [
+        cStage = GetShaderStage(Stage)
+      ] (DxvkContext* ctx, D3D11CmdShaderResourceBinding* bindings, size_t count) {
+        for (size_t j = 0; j < count; j++) {
+          if (bindings[j].bufferView != nullptr)
+            ctx->bindResourceBufferView(cStage, bindings[j].slot, Forwarder::move(bindings[j].bufferView));
+          else
+            ctx->bindResourceImageView(cStage, bindings[j].slot, Forwarder::move(bindings[j].imageView));
+        }
+      });
+
+      uint32_t index = 0u;
+
+      for (uint32_t slot : bit::BitMask(bindMask)) {
+        auto view = state.views[slot + i].ptr();
+
+        auto binding = new (m_csData->at(index++)) D3D11CmdShaderResourceBinding();
+        binding->slot = computeSrvBinding(Stage, slot + i);
+
+        if (view) {
+          if (view->GetViewInfo().Dimension != D3D11_RESOURCE_DIMENSION_BUFFER)
+            binding->imageView = view->GetImageView();
+          else
+            binding->bufferView = view->GetBufferView();
+        }
+      }
     }
   }
 
@@ -3489,6 +3562,31 @@ namespace dxvk {
   }
 
 
+  template<typename ContextType>
+  void D3D11CommonContext<ContextType>::BatchBufferRename(
+          D3D11Buffer*                      pBuffer,
+          Rc<DxvkResourceAllocation>&&      storage) {
+    // Batch consecutive renames, which is common for
+    // constant buffers that are updated before a draw
+    if (m_csDataType == D3D11CmdType::BufferRename) {
+      auto* renameInfo = m_csChunk->pushData(m_csData, 1u);
+
+      if (likely(renameInfo)) {
+        new (renameInfo) D3D11CmdBufferRename { pBuffer->GetBuffer(), std::move(storage) };
+        return;
+      }
+    }
+
+    EmitCsCmd<D3D11CmdBufferRename>(D3D11CmdType::BufferRename, 1u,
+      [] (DxvkContext* ctx, D3D11CmdBufferRename* renames, size_t count) {
+        for (size_t i = 0; i < count; i++)
+          ctx->invalidateBuffer(renames[i].buffer, Forwarder::move(renames[i].storage));
+      });
+
+    new (m_csData->first()) D3D11CmdBufferRename { pBuffer->GetBuffer(), std::move(storage) };
+  }
+
+
   template<typename ContextType>
   void D3D11CommonContext<ContextType>::BatchDraw(
     const VkDrawIndirectCommand&            draw) {
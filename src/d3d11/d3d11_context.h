@@ -848,6 +848,10 @@ namespace dxvk {
 
     void ApplyViewportState();
 
+    void BatchBufferRename(
+            D3D11Buffer*                      pBuffer,
+            Rc<DxvkResourceAllocation>&&      storage);
+
     void BatchDraw(
       const VkDrawIndirectCommand&            draw);
 
@@ -286,12 +286,7 @@ namespace dxvk {
     pMappedResource->RowPitch     = pBuffer->Desc()->ByteWidth;
     pMappedResource->DepthPitch   = pBuffer->Desc()->ByteWidth;
 
-    EmitCs([
-      cDstBuffer = pBuffer->GetBuffer(),
-      cDstSlice  = std::move(bufferSlice)
-    ] (DxvkContext* ctx) {
-      ctx->invalidateBuffer(cDstBuffer, Rc<DxvkResourceAllocation>(cDstSlice));
-    });
+    BatchBufferRename(pBuffer, std::move(bufferSlice));
 
     AddMapEntry(pBuffer->GetCookie(), *pMappedResource);
     return S_OK;
@@ -369,7 +364,6 @@ namespace dxvk {
       // safely ignore the MapBuffer return value here
       D3D11_MAPPED_SUBRESOURCE mapInfo;
       MapBuffer(pDstBuffer, &mapInfo);
-      AddMapEntry(pDstBuffer->GetCookie(), mapInfo);
       mapPtr = mapInfo.pData;
     }
 
@@ -426,25 +420,18 @@ namespace dxvk {
 
   D3D11_MAPPED_SUBRESOURCE D3D11DeferredContext::FindMapEntry(
           uint64_t                      Cookie) {
-    // Recently mapped resources as well as entries with
-    // up-to-date map infos will be located at the end
-    // of the resource array, so scan in reverse order.
-    size_t size = m_mappedResources.size();
-
-    for (size_t i = 1; i <= size; i++) {
-      const auto& entry = m_mappedResources[size - i];
+    auto entry = m_mappedResources.find(Cookie);
 
-      if (entry.ResourceCookie == Cookie)
-        return entry.MapInfo;
-    }
+    if (entry == m_mappedResources.end())
+      return D3D11_MAPPED_SUBRESOURCE();
 
-    return D3D11_MAPPED_SUBRESOURCE();
+    return entry->second;
   }
 
   void D3D11DeferredContext::AddMapEntry(
           uint64_t                      Cookie,
     const D3D11_MAPPED_SUBRESOURCE&     MapInfo) {
-    m_mappedResources.push_back({ Cookie, MapInfo });
+    m_mappedResources.insert_or_assign(Cookie, MapInfo);
   }
 
 }
@@ -3,15 +3,11 @@
 #include "d3d11_cmdlist.h"
 #include "d3d11_context.h"
 
+#include <unordered_map>
 #include <vector>
 
 namespace dxvk {
   
-  struct D3D11DeferredContextMapEntry {
-    uint64_t                  ResourceCookie = 0u;
-    D3D11_MAPPED_SUBRESOURCE  MapInfo = { };
-  };
-  
   class D3D11DeferredContext : public D3D11CommonContext<D3D11DeferredContext> {
     friend class D3D11CommonContext<D3D11DeferredContext>;
   public:
@@ -83,10 +79,9 @@ namespace dxvk {
     // Command list that we're recording
     Com<D3D11CommandList> m_commandList;
     
-    // Info about currently mapped (sub)resources. Using a vector
-    // here is reasonable since there will usually only be a small
-    // number of mapped resources per command list.
-    std::vector<D3D11DeferredContextMapEntry> m_mappedResources;
+    // Info about currently mapped (sub)resources, indexed by the
+    // resource cookie. Only the most recent mapping is relevant.
+    std::unordered_map<uint64_t, D3D11_MAPPED_SUBRESOURCE> m_mappedResources;
     
     // Begun and ended queries, will also be stored in command list
     std::vector<Com<D3D11Query, false>> m_queriesBegun;
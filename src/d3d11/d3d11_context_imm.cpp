@@ -260,9 +260,14 @@ namespace dxvk {
     // number of pending draw calls is high enough.
     ConsiderFlush(GpuFlushType::ImplicitWeakHint);
 
+    // All resources used by the command list were created before it
+    // was recorded, so flushing initialization commands once up front
+    // is sufficient and avoids taking the initializer lock per chunk.
+    m_parent->FlushInitCommands();
+
     // Dispatch command list to the CS thread
     commandList->EmitToCsThread([this] (DxvkCsChunkRef&& chunk, GpuFlushType flushType) {
-      EmitCsChunk(std::move(chunk));
+      m_csSeqNum = m_csThread.dispatchChunk(std::move(chunk));
 
       // Return the sequence number from before the flush since
       // that is actually going to be needed for resource tracking
@@ -360,12 +365,7 @@ namespace dxvk {
       pMappedResource->RowPitch   = bufferSize;
       pMappedResource->DepthPitch = bufferSize;
       
-      EmitCs([
-        cBuffer      = pResource->GetBuffer(),
-        cBufferSlice = std::move(bufferSlice)
-      ] (DxvkContext* ctx) mutable {
-        ctx->invalidateBuffer(cBuffer, std::move(cBufferSlice));
-      });
+      BatchBufferRename(pResource, std::move(bufferSlice));
 
       // Ignore small buffers here. These are often updated per
       // draw and won't contribute much to memory waste anyway.
@@ -759,12 +759,7 @@ namespace dxvk {
       auto bufferSlice = pDstBuffer->DiscardSlice(&m_allocationCache);
       mapPtr = bufferSlice->mapPtr();
 
-      EmitCs([
-        cBuffer      = pDstBuffer->GetBuffer(),
-        cBufferSlice = std::move(bufferSlice)
-      ] (DxvkContext* ctx) mutable {
-        ctx->invalidateBuffer(cBuffer, std::move(cBufferSlice));
-      });
+      BatchBufferRename(pDstBuffer, std::move(bufferSlice));
     } else {
       mapPtr = pDstBuffer->GetMapPtr();
     }
@@ -767,6 +767,15 @@ namespace dxvk {
       uint32_t attrCount = CompactSparseList(attrList.data(), attrMask);
       uint32_t bindCount = CompactSparseList(bindList.data(), bindMask);
 
+      // Vulkan does not care about the order in which attributes are
+      // declared, so sort them by location. This way, layouts which
+      // only differ in element order result in the same vertex input
+      // state and can share pipelines and vertex input libraries.
+      std::sort(attrList.begin(), attrList.begin() + attrCount,
+        [] (const DxvkVertexAttribute& a, const DxvkVertexAttribute& b) {
+          return a.location < b.location;
+        });
+
       if (!ppInputLayout)
         return S_FALSE;
 
@@ -128,11 +128,7 @@ namespace dxvk {
     } else {
       m_transferCommands += 1;
 
-      EmitCs([
-        cBuffer       = buffer
-      ] (DxvkContext* ctx) {
-        ctx->initBuffer(cBuffer);
-      });
+      QueueBufferClear(std::move(buffer));
     }
 
     ThrottleAllocationLocked();
@@ -355,6 +351,11 @@ namespace dxvk {
   void D3D11Initializer::ExecuteFlushLocked() {
     DxvkStagingBufferStats stats = m_stagingBuffer.getStatistics();
 
+    // Make sure pending clears are part of this submission
+    std::unique_lock<dxvk::mutex> csLock(m_csMutex);
+    EmitBufferClearsLocked();
+    csLock.unlock();
+
     EmitCs([
       cSignal       = m_stagingSignal,
       cSignalValue  = stats.allocatedTotal
@@ -404,4 +405,29 @@ namespace dxvk {
     m_transferCommands = 0;
   }
 
+
+  void D3D11Initializer::QueueBufferClear(
+          Rc<DxvkBuffer>&&            Buffer) {
+    // Zero-initialization does not need any staging memory, so
+    // gather buffers and clear them all with a single command
+    // rather than emitting one command per created resource.
+    std::lock_guard<dxvk::mutex> lock(m_csMutex);
+    m_bufferClears.push_back(std::move(Buffer));
+  }
+
+
+  void D3D11Initializer::EmitBufferClearsLocked() {
+    if (m_bufferClears.empty())
+      return;
+
+    EmitCsLocked([
+      cBuffers = std::move(m_bufferClears)
+    ] (DxvkContext* ctx) {
+      for (const auto& buffer : cBuffers)
+        ctx->initBuffer(buffer);
+    });
+
+    m_bufferClears.clear();
+  }
+
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "../dxvk/dxvk_staging.h"
 
 #include "d3d11_buffer.h"
@@ -41,6 +43,7 @@ namespace dxvk {
 
     void FlushCsChunk() {
       std::lock_guard<dxvk::mutex> lock(m_csMutex);
+      EmitBufferClearsLocked();
 
       if (!m_csChunk->empty())
         FlushCsChunkLocked();
@@ -79,6 +82,8 @@ namespace dxvk {
     dxvk::mutex       m_csMutex;
     DxvkCsChunkRef    m_csChunk;
 
+    std::vector<Rc<DxvkBuffer>> m_bufferClears;
+
     void InitDeviceLocalBuffer(
             D3D11Buffer*                pBuffer,
       const D3D11_SUBRESOURCE_DATA*     pInitialData);
@@ -111,10 +116,19 @@ namespace dxvk {
 
     void NotifyContextFlushLocked();
 
+    void QueueBufferClear(
+            Rc<DxvkBuffer>&&            Buffer);
+
+    void EmitBufferClearsLocked();
+
     template<typename Cmd>
     void EmitCs(Cmd&& command) {
       std::lock_guard<dxvk::mutex> lock(m_csMutex);
+      EmitCsLocked(std::forward<Cmd>(command));
+    }
 
+    template<typename Cmd>
+    void EmitCsLocked(Cmd&& command) {
       if (unlikely(!m_csChunk->push(command))) {
         FlushCsChunkLocked();
 
@@ -33,6 +33,7 @@ namespace dxvk {
     bool exposeDriverCommandLists;
     bool reproducibleCommandStream;
     bool disableDirectImageMapping;
+    bool predictOcclusionQueries;
     Tristate sincosEmulation;
 
     // Memory management
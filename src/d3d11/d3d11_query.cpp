@@ -22,11 +22,22 @@ namespace dxvk {
         m_query[0] = dxvkDevice->createGpuQuery(
           VK_QUERY_TYPE_OCCLUSION,
           VK_QUERY_CONTROL_PRECISE_BIT, 0);
+
+        if (m_parent->GetOptions()->predictOcclusionQueries) {
+          m_predictQuery = dxvkDevice->createGpuQuery(
+            VK_QUERY_TYPE_OCCLUSION,
+            VK_QUERY_CONTROL_PRECISE_BIT, 0);
+        }
         break;
       
       case D3D11_QUERY_OCCLUSION_PREDICATE:
         m_query[0] = dxvkDevice->createGpuQuery(
           VK_QUERY_TYPE_OCCLUSION, 0, 0);
+
+        if (m_parent->GetOptions()->predictOcclusionQueries) {
+          m_predictQuery = dxvkDevice->createGpuQuery(
+            VK_QUERY_TYPE_OCCLUSION, 0, 0);
+        }
         break;
         
       case D3D11_QUERY_TIMESTAMP:
@@ -197,6 +208,9 @@ namespace dxvk {
         break;
       
       default:
+        if (m_predictQuery != nullptr)
+          UpdatePrediction();
+
         ctx->beginQuery(m_query[0]);
     }
   }
@@ -248,7 +262,7 @@ namespace dxvk {
       return DXGI_ERROR_INVALID_CALL;
 
     if (m_resetCtr != 0u)
-      return S_FALSE;
+      return GetPredictedData(pData);
 
     if (m_desc.Query == D3D11_QUERY_EVENT) {
       DxvkGpuEventStatus status = m_event[0]->test();
@@ -273,8 +287,11 @@ namespace dxvk {
           return DXGI_ERROR_INVALID_CALL;
         
         if (status == DxvkGpuQueryStatus::Pending)
-          return S_FALSE;
+          return GetPredictedData(pData);
       }
+
+      if (m_predictQuery != nullptr)
+        m_lastSamplesPassed.store(queryData[0].occlusion.samplesPassed, std::memory_order_relaxed);
       
       if (pData == nullptr)
         return S_OK;
@@ -341,6 +358,42 @@ namespace dxvk {
   }
   
   
+  HRESULT D3D11Query::GetPredictedData(void* pData) const {
+    if (m_predictQuery == nullptr)
+      return S_FALSE;
+
+    if (pData != nullptr) {
+      UINT64 samplesPassed = m_lastSamplesPassed.load(std::memory_order_relaxed);
+
+      if (m_desc.Query == D3D11_QUERY_OCCLUSION_PREDICATE)
+        *static_cast<BOOL*>(pData) = samplesPassed != 0;
+      else
+        *static_cast<UINT64*>(pData) = samplesPassed;
+    }
+
+    return S_OK;
+  }
+
+
+  void D3D11Query::UpdatePrediction() {
+    // Called on the CS thread right before the query gets reset. Apps
+    // that consume predicted results may never read the actual result,
+    // so collect it here. If the query is still pending, keep it alive
+    // as the prediction query and reuse the older one for this pass.
+    DxvkQueryData queryData = { };
+
+    if (m_predictQuery->getData(queryData) == DxvkGpuQueryStatus::Available)
+      m_lastSamplesPassed.store(queryData.occlusion.samplesPassed, std::memory_order_relaxed);
+
+    DxvkGpuQueryStatus status = m_query[0]->getData(queryData);
+
+    if (status == DxvkGpuQueryStatus::Available)
+      m_lastSamplesPassed.store(queryData.occlusion.samplesPassed, std::memory_order_relaxed);
+    else if (status == DxvkGpuQueryStatus::Pending)
+      std::swap(m_query[0], m_predictQuery);
+  }
+
+
   UINT64 D3D11Query::GetTimestampQueryFrequency() const {
     Rc<DxvkDevice>  device  = m_parent->GetDXVKDevice();
     Rc<DxvkAdapter> adapter = device->adapter();
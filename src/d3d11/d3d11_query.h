@@ -113,8 +113,15 @@ namespace dxvk {
 
     std::atomic<uint32_t> m_resetCtr = { 0u };
 
+    Rc<DxvkQuery>         m_predictQuery;
+    std::atomic<UINT64>   m_lastSamplesPassed = { ~0ull };
+
     D3DDestructionNotifier m_destructionNotifier;
 
+    HRESULT GetPredictedData(void* pData) const;
+
+    void UpdatePrediction();
+
     UINT64 GetTimestampQueryFrequency() const;
     
   };
@@ -1,3 +1,5 @@
+#include "../util/util_time.h"
+
 #include "d3d11_device.h"
 #include "d3d11_shader.h"
 
@@ -45,10 +47,15 @@ namespace dxvk {
     if (programInfo->shaderStage() != pShaderKey->type() && !passthroughShader)
       throw DxvkError("Mismatching shader type.");
 
+    auto t0 = dxvk::high_resolution_clock::now();
+
     m_shader = passthroughShader
       ? module.compilePassthroughShader(*pDxbcModuleInfo, name)
       : module.compile                 (*pDxbcModuleInfo, name);
     m_shader->setShaderKey(*pShaderKey);
+    m_shader->setTranslationStats(BytecodeLength,
+      std::chrono::duration_cast<std::chrono::microseconds>(
+        dxvk::high_resolution_clock::now() - t0).count());
     
     if (dumpPath.size() != 0) {
       std::ofstream dumpStream(
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <unordered_map>
 
 #include "d3d11_blend.h"
@@ -7,6 +8,8 @@
 #include "d3d11_rasterizer.h"
 #include "d3d11_sampler.h"
 
+#include "../util/util_math.h"
+
 namespace dxvk {
   
   class D3D11Device;
@@ -42,6 +45,8 @@ namespace dxvk {
   template<typename T>
   class D3D11StateObjectSet {
     using DescType = typename T::DescType;
+
+    constexpr static size_t ShardCount = 16;
   public:
     
     /**
@@ -54,14 +59,17 @@ namespace dxvk {
      * \returns Pointer to the state object
      */
     T* Create(D3D11Device* device, const DescType& desc) {
-      std::lock_guard<dxvk::mutex> lock(m_mutex);
+      size_t hash = D3D11StateDescHash()(desc);
+
+      auto& shard = m_shards[(hash ^ (hash >> 16)) % ShardCount];
+      std::lock_guard<dxvk::mutex> lock(shard.mutex);
       
-      auto entry = m_objects.find(desc);
+      auto entry = shard.objects.find(desc);
       
-      if (entry != m_objects.end())
+      if (entry != shard.objects.end())
         return ref(&entry->second);
       
-      auto result = m_objects.emplace(
+      auto result = shard.objects.emplace(
         std::piecewise_construct,
         std::tuple(desc),
         std::tuple(device, desc));
@@ -69,10 +77,21 @@ namespace dxvk {
     }
     
   private:
-    
-    dxvk::mutex                                m_mutex;
-    std::unordered_map<DescType, T,
-      D3D11StateDescHash, D3D11StateDescEqual> m_objects;
+
+    /**
+     * \brief Object set shard
+     *
+     * Objects are distributed across multiple independently
+     * locked maps so that applications creating state objects
+     * from multiple threads do not contend on a single lock.
+     */
+    struct alignas(CACHE_LINE_SIZE) Shard {
+      dxvk::mutex                                mutex;
+      std::unordered_map<DescType, T,
+        D3D11StateDescHash, D3D11StateDescEqual> objects;
+    };
+
+    std::array<Shard, ShardCount> m_shards;
     
   };
   
@@ -1130,6 +1130,7 @@ namespace dxvk {
           m_ctx->ResetCommandListState();
 
           CopyBaseImageToShadow(outputView);
+          CopyStreamsToShadow(videoProcessor, StreamCount, pStreams);
 
           hasStreamsEnabled = true;
         }
@@ -1338,8 +1339,6 @@ namespace dxvk {
 
     auto& view = static_cast<D3D11VideoProcessorInputView*>(pStream->pInputSurface)->GetCommon();
 
-    CopyBaseImageToShadow(view);
-
     m_ctx->EmitCs([this,
       cStreamState  = *pStreamState,
       cImage        = view.GetImage(),
@@ -1457,6 +1456,23 @@ namespace dxvk {
   }
 
 
+  void D3D11VideoContext::CopyStreamsToShadow(
+          D3D11VideoProcessor*            pVideoProcessor,
+          UINT                            StreamCount,
+    const D3D11_VIDEO_PROCESSOR_STREAM*   pStreams) {
+    // Input surfaces are not written during the blit, so syncing
+    // them once is sufficient even if multiple output planes are
+    // rendered. Doing this per plane would copy planar inputs twice.
+    for (uint32_t i = 0; i < StreamCount; i++) {
+      if (!pStreams[i].Enable || !pVideoProcessor->GetStreamState(i))
+        continue;
+
+      auto& view = static_cast<D3D11VideoProcessorInputView*>(pStreams[i].pInputSurface)->GetCommon();
+      CopyBaseImageToShadow(view);
+    }
+  }
+
+
   void D3D11VideoContext::CopyShadowToBaseImage(
     const D3D11VideoProcessorView&        View) {
     auto shadow = View.GetShadow();
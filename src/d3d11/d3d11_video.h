@@ -692,6 +692,11 @@ namespace dxvk {
     void CopyBaseImageToShadow(
       const D3D11VideoProcessorView&        View);
 
+    void CopyStreamsToShadow(
+            D3D11VideoProcessor*            pVideoProcessor,
+            UINT                            StreamCount,
+      const D3D11_VIDEO_PROCESSOR_STREAM*   pStreams);
+
     void CopyShadowToBaseImage(
       const D3D11VideoProcessorView&        View);
 
@@ -4,6 +4,8 @@
 #include "d3d8_buffer.h"
 #include "d3d8_format.h"
 
+#include "../util/util_bit.h"
+
 #include <vector>
 #include <cstdint>
 
@@ -100,15 +102,16 @@ namespace dxvk {
     }
 
     inline void StateChange() {
-      if (likely(m_batches.empty()))
-        return;
+      bool flushed = false;
+
       for (auto& draw : m_batches) {
 
         if (draw.PrimitiveType == D3DPT_INVALID)
           continue;
 
-        for (auto& index : draw.Indices)
-          index -= draw.MinVertex;
+        // The UP draw copies vertex data starting at the first vertex
+        // we pass, so rebase indices to the lowest referenced vertex.
+        RebaseIndices(draw.Indices.data(), draw.Offset, uint16_t(draw.MinVertex));
 
         m_device->DrawIndexedPrimitiveUP(
           d3d9::D3DPRIMITIVETYPE(draw.PrimitiveType),
@@ -120,8 +123,7 @@ namespace dxvk {
           m_stream->GetPtr(draw.MinVertex * m_stride),
           m_stride);
 
-        m_device->SetStreamSource(0, D3D8VertexBuffer::GetD3D9Nullable(m_stream), 0, m_stride);
-        m_device->SetIndices(D3D8IndexBuffer::GetD3D9Nullable(m_indices));
+        flushed = true;
 
         draw.PrimitiveType = D3DPRIMITIVETYPE(0);
         draw.Offset = 0;
@@ -130,6 +132,13 @@ namespace dxvk {
         draw.PrimitiveCount = 0;
         draw.DrawCallCount = 0;
       }
+
+      // UP draws unbind stream 0 and the index buffer, restore
+      // them once after all batches have been submitted.
+      if (flushed) {
+        m_device->SetStreamSource(0, D3D8VertexBuffer::GetD3D9Nullable(m_stream), 0, m_stride);
+        m_device->SetIndices(D3D8IndexBuffer::GetD3D9Nullable(m_indices));
+      }
     }
 
     inline void EndFrame() {
@@ -182,18 +191,31 @@ namespace dxvk {
             batch->Indices[batch->Offset++] = (StartVertex + i * 3 + 2);
           }
           break;
-        case D3DPT_TRIANGLESTRIP:
-          // Join with degenerate triangle
-          // 1 2 3, 3 4, 4 5 6
-          batch->Indices.resize(batch->Offset + PrimitiveCount + 2);
-          if (batch->Offset > 0) {
-            batch->Indices[batch->Offset + 1] = batch->Indices[batch->Offset-2];
-            batch->Indices[batch->Offset += 2] = StartVertex;
-          }
-          for (UINT i = 0; i < PrimitiveCount; i++) {
-            batch->Indices[batch->Offset++] = (StartVertex + i + 0);
+        case D3DPT_TRIANGLESTRIP: {
+          // Join with degenerate triangles
+          // 1 2 3 4, 4 5, 5 6 7 8
+          // If the previous strip ends on an odd index, repeat its last
+          // vertex once more so that the next strip keeps its winding.
+          UINT vertexCount = PrimitiveCount + 2;
+          UINT joinCount   = 0;
+
+          if (batch->Offset > 0)
+            joinCount = (batch->Offset & 1) ? 3 : 2;
+
+          batch->Indices.resize(batch->Offset + joinCount + vertexCount);
+
+          if (joinCount) {
+            uint16_t lastIndex = batch->Indices[batch->Offset - 1];
+
+            for (UINT i = 0; i < joinCount - 1; i++)
+              batch->Indices[batch->Offset++] = lastIndex;
+
+            batch->Indices[batch->Offset++] = StartVertex;
           }
-          break;
+
+          for (UINT i = 0; i < vertexCount; i++)
+            batch->Indices[batch->Offset++] = (StartVertex + i);
+        } break;
         // 1 2 3 4 5 6 7 -> 1 2 3, 1 3 4, 1 4 5, 1 5 6, 1 6 7
         case D3DPT_TRIANGLEFAN:
           batch->Indices.resize(batch->Offset + PrimitiveCount * 3);
@@ -209,7 +231,13 @@ namespace dxvk {
       batch->MinVertex = std::min(batch->MinVertex, StartVertex);
       if (!batch->Indices.empty())
         batch->MaxVertex = std::max(batch->MaxVertex, UINT(batch->Indices.back() + 1));
-      batch->PrimitiveCount += PrimitiveCount;
+      // Strips are merged into one long strip, including the
+      // degenerate triangles used to join them.
+      if (PrimitiveType == D3DPT_TRIANGLESTRIP)
+        batch->PrimitiveCount = batch->Offset - 2;
+      else
+        batch->PrimitiveCount += PrimitiveCount;
+
       batch->DrawCallCount++;
       return D3D_OK;
     }
@@ -236,6 +264,22 @@ namespace dxvk {
 
   private:
 
+    static void RebaseIndices(uint16_t* pIndices, size_t Count, uint16_t Base) {
+      size_t i = 0;
+
+#if defined(DXVK_ARCH_X86)
+      const __m128i base = _mm_set1_epi16(int16_t(Base));
+
+      for ( ; i + 8 <= Count; i += 8) {
+        __m128i* ptr = reinterpret_cast<__m128i*>(pIndices + i);
+        _mm_storeu_si128(ptr, _mm_sub_epi16(_mm_loadu_si128(ptr), base));
+      }
+#endif
+
+      for ( ; i < Count; i++)
+        pIndices[i] -= Base;
+    }
+
     D3D8Device*                     m_device8;
     Com<d3d9::IDirect3DDevice9>     m_device;
 
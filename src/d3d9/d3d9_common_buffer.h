@@ -133,8 +133,8 @@ namespace dxvk {
       return DxvkBufferSlice();
     }
 
-    inline Rc<DxvkResourceAllocation> DiscardMapSlice() {
-      m_allocation = GetMapBuffer()->allocateStorage();
+    inline Rc<DxvkResourceAllocation> DiscardMapSlice(DxvkLocalAllocationCache* pCache = nullptr) {
+      m_allocation = GetMapBuffer()->allocateStorage(pCache);
       return m_allocation;
     }
 
@@ -97,6 +97,9 @@ namespace dxvk {
 
     m_device->RemoveMappedTexture(this);
 
+    if (IsQueuedForUpload())
+      m_device->RemovePendingManagedUpload(this);
+
     if (m_desc.Pool == D3DPOOL_DEFAULT)
       m_device->DecrementLosableCounter();
   }
@@ -385,6 +385,9 @@ namespace dxvk {
     void SetNeedsMipGen(bool value) { m_needsMipGen = value; }
     bool NeedsMipGen() const { return m_needsMipGen; }
 
+    void SetQueuedForUpload(bool value) { m_queuedForUpload = value; }
+    bool IsQueuedForUpload() const { return m_queuedForUpload; }
+
     DWORD ExposedMipLevels() const { return m_exposedMipLevels; }
 
     void SetMipFilter(D3DTEXTUREFILTERTYPE filter) { m_mipFilter = filter; }
@@ -525,6 +528,8 @@ namespace dxvk {
 
     bool                          m_needsMipGen = false;
 
+    bool                          m_queuedForUpload = false;
+
     D3DTEXTUREFILTERTYPE          m_mipFilter = D3DTEXF_LINEAR;
 
     std::array<D3DBOX, 6>         m_dirtyBoxes;
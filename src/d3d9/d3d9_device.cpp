@@ -64,6 +64,10 @@ namespace dxvk {
     , m_d3d9On12           ( this )
     , m_d3d8Bridge         ( this ) {
 
+    m_discardAllocationCache = m_dxvkDevice->createAllocationCache(
+      VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT,
+      DiscardAllocationCacheMemoryFlags);
+
     // If we can SWVP, then we use an extended constant set
     // as SWVP has many more slots available than HWVP.
     bool canSWVP = CanSWVP();
@@ -2985,6 +2989,11 @@ namespace dxvk {
     if (unlikely(!PrimitiveCount))
       return S_OK;
 
+    if (unlikely(m_trackMergeableDraws)) {
+      CountMergeableDraw(PrimitiveType, BaseVertexIndex,
+        MinVertexIndex, NumVertices, StartIndex, PrimitiveCount);
+    }
+
     bool dynamicSysmemVBOs;
     bool dynamicSysmemIBO;
     uint32_t indexCount = GetVertexCount(PrimitiveType, PrimitiveCount);
@@ -3000,6 +3009,9 @@ namespace dxvk {
 
     PrepareDraw(PrimitiveType, !dynamicSysmemVBOs, !dynamicSysmemIBO);
 
+    if (unlikely(m_trackMergeableDraws))
+      StoreMergeableDrawState();
+
     EmitCs([this,
       cPrimType        = PrimitiveType,
       cPrimCount       = PrimitiveCount,
@@ -5075,6 +5087,9 @@ namespace dxvk {
           pResource->ClearDirtyBoxes();
     }
 
+    if (pResource->IsManaged() && m_d3d9Options.eagerManagedUpload)
+      QueueManagedUpload(pResource);
+
     // Toss our staging buffer if we're not dynamic
     // and we aren't managed (for sysmem copy.)
     bool shouldToss  = pResource->GetMapMode() == D3D9_COMMON_TEXTURE_MAP_MODE_BACKED;
@@ -5358,7 +5373,7 @@ namespace dxvk {
       // it as the 'new' mapped slice. This assumes that the
       // only way to invalidate a buffer is by mapping it.
       Rc<DxvkBuffer> mappingBuffer = pResource->GetBuffer<D3D9_COMMON_BUFFER_TYPE_MAPPING>();
-      auto bufferSlice = pResource->DiscardMapSlice();
+      auto bufferSlice = pResource->DiscardMapSlice(GetDiscardAllocationCache(*mappingBuffer));
       data = reinterpret_cast<uint8_t*>(bufferSlice->mapPtr());
 
       EmitCs([
@@ -6153,6 +6168,11 @@ namespace dxvk {
   void D3D9DeviceEx::EndFrame(Rc<DxvkLatencyTracker> LatencyTracker) {
     D3D9DeviceLock lock = LockDevice();
 
+    if (unlikely(m_pendingManagedUploads.size()))
+      FlushManagedUploads();
+
+    m_mergeableDrawsLastFrame = std::exchange(m_mergeableDraws, 0u);
+
     EmitCs<false>([
       cTracker = std::move(LatencyTracker)
     ] (DxvkContext* ctx) {
@@ -6447,6 +6467,39 @@ namespace dxvk {
   }
 
 
+  void D3D9DeviceEx::QueueManagedUpload(D3D9CommonTexture* pResource) {
+    // Uploads are processed in unlock order, a texture that
+    // gets unlocked again moves to the back of the queue.
+    if (pResource->NeedsAnyUpload() && !pResource->IsAnySubresourceLocked()) {
+      m_pendingManagedUploads.insert(pResource);
+      pResource->SetQueuedForUpload(true);
+    }
+  }
+
+
+  void D3D9DeviceEx::FlushManagedUploads() {
+    auto iter = m_pendingManagedUploads.leastRecentlyUsedIter();
+
+    while (iter != m_pendingManagedUploads.leastRecentlyUsedEndIter()) {
+      D3D9CommonTexture* texture = *iter;
+
+      // The texture may have been uploaded by a draw or locked again
+      // since it was queued, in which case there is nothing to do yet.
+      if (texture->NeedsAnyUpload() && !texture->IsAnySubresourceLocked()) {
+        UploadManagedTexture(texture);
+
+        if (texture->NeedsMipGen()) {
+          EmitGenerateMips(texture);
+          MarkTextureMipsUnDirty(texture);
+        }
+      }
+
+      texture->SetQueuedForUpload(false);
+      iter = m_pendingManagedUploads.remove(iter);
+    }
+  }
+
+
   void D3D9DeviceEx::UpdateTextureTypeMismatchesForShader(const D3D9CommonShader* shader, uint32_t shaderSamplerMask, uint32_t shaderSamplerOffset) {
     const uint32_t stageCorrectedShaderSamplerMask = shaderSamplerMask << shaderSamplerOffset;
     if (unlikely(shader->GetInfo().majorVersion() < 2 || m_d3d9Options.forceSamplerTypeSpecConstants)) {
@@ -7345,12 +7398,39 @@ namespace dxvk {
   }
 
 
+  void D3D9DeviceEx::CountMergeableDraw(
+          D3DPRIMITIVETYPE PrimitiveType,
+          INT              BaseVertexIndex,
+          UINT             MinVertexIndex,
+          UINT             NumVertices,
+          UINT             StartIndex,
+          UINT             PrimitiveCount) {
+    D3D9IndexedDrawKey& drawKey = m_currentIndexedDraw;
+    drawKey.primitiveType   = PrimitiveType;
+    drawKey.baseVertexIndex = BaseVertexIndex;
+    drawKey.minVertexIndex  = MinVertexIndex;
+    drawKey.numVertices     = NumVertices;
+    drawKey.startIndex      = StartIndex;
+    drawKey.primitiveCount  = PrimitiveCount;
+    drawKey.vertexDecl      = m_state.vertexDecl.ptr();
+    drawKey.vertexShader    = m_state.vertexShader.ptr();
+    drawKey.pixelShader     = m_state.pixelShader.ptr();
+    drawKey.indexBuffer     = m_state.indices.ptr();
+
+    if (drawKey.eq(m_lastIndexedDraw) && IsOnlyVertexDataDirty())
+      m_mergeableDraws += 1;
+  }
+
+
   uint32_t D3D9DeviceEx::GetInstanceCount() const {
     return std::max(m_state.streamFreq[0] & 0x7FFFFFu, 1u);
   }
 
 
   void D3D9DeviceEx::PrepareDraw(D3DPRIMITIVETYPE PrimitiveType, bool UploadVBOs, bool UploadIBO) {
+    if (unlikely(m_trackMergeableDraws))
+      m_lastIndexedDraw = D3D9IndexedDrawKey();
+
     if (unlikely(m_textureSlotTracking.unresolvableHazardRT != 0 || m_textureSlotTracking.unresolvableHazardDS != 0))
       EmitFeedbackLoopBarriers();
 
@@ -8717,6 +8797,12 @@ namespace dxvk {
 #endif
   }
 
+  void D3D9DeviceEx::RemovePendingManagedUpload(D3D9CommonTexture* pTexture) {
+    D3D9DeviceLock lock = LockDevice();
+    m_pendingManagedUploads.remove(pTexture);
+    pTexture->SetQueuedForUpload(false);
+  }
+
   void D3D9DeviceEx::RemoveMappedTexture(D3D9CommonTexture* pTexture) {
 #ifdef D3D9_ALLOW_UNMAPPING
     if (pTexture->GetMapMode() != D3D9_COMMON_TEXTURE_MAP_MODE_UNMAPPABLE)
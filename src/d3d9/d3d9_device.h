@@ -104,6 +104,52 @@ namespace dxvk {
     uint32_t instanceCount;
   };
 
+  /**
+   * \brief Indexed draw parameters
+   *
+   * Used to detect consecutive draws of the same geometry
+   * which could be merged into a single instanced draw.
+   */
+  struct D3D9IndexedDrawKey {
+    D3DPRIMITIVETYPE primitiveType   = D3DPRIMITIVETYPE(0);
+    INT              baseVertexIndex = 0;
+    UINT             minVertexIndex  = 0;
+    UINT             numVertices     = 0;
+    UINT             startIndex      = 0;
+    UINT             primitiveCount  = 0;
+    const void*      vertexDecl      = nullptr;
+    const void*      vertexShader    = nullptr;
+    const void*      pixelShader     = nullptr;
+    const void*      indexBuffer     = nullptr;
+
+    bool eq(const D3D9IndexedDrawKey& other) const {
+      return primitiveType   == other.primitiveType
+          && vertexDecl      == other.vertexDecl
+          && vertexShader    == other.vertexShader
+          && pixelShader     == other.pixelShader
+          && indexBuffer     == other.indexBuffer
+          && baseVertexIndex == other.baseVertexIndex
+          && minVertexIndex  == other.minVertexIndex
+          && numVertices     == other.numVertices
+          && startIndex      == other.startIndex
+          && primitiveCount  == other.primitiveCount;
+    }
+  };
+
+  /**
+   * \brief Dirty state after a draw
+   *
+   * Some dirty flags and masks are only cleared when they are relevant
+   * to the current draw, so state changes between two draws are detected
+   * by comparing against the dirty state left behind by the last draw.
+   */
+  struct D3D9DrawDirtyState {
+    D3D9DeviceFlags flags;
+    uint32_t        textureDirty      = 0u;
+    uint32_t        samplerStateDirty = 0u;
+    bool            psConstantsDirty  = false;
+  };
+
   struct D3D9BufferSlice {
     DxvkBufferSlice slice = {};
     void*           mapPtr = nullptr;
@@ -225,6 +271,10 @@ namespace dxvk {
 
     constexpr static VkDeviceSize StagingBufferSize = 4ull << 20;
 
+    // Memory properties of write-only dynamic buffers, see D3D9CommonBuffer
+    constexpr static VkMemoryPropertyFlags DiscardAllocationCacheMemoryFlags =
+      VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT | VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
     friend class D3D9SwapChainEx;
     friend struct D3D9WindowContext;
     friend class D3D9ConstantBuffer;
@@ -816,6 +866,19 @@ namespace dxvk {
       return m_dxvkDevice;
     }
 
+    /**
+     * \brief Returns the allocation cache for buffer renames
+     *
+     * \param [in] Buffer Buffer that is about to be renamed
+     * \returns Allocation cache, or \c nullptr if the buffer
+     *    uses memory properties incompatible with the cache.
+     */
+    DxvkLocalAllocationCache* GetDiscardAllocationCache(const DxvkBuffer& Buffer) {
+      return Buffer.memFlags() == DiscardAllocationCacheMemoryFlags
+        ? &m_discardAllocationCache
+        : nullptr;
+    }
+
     D3D9_VK_FORMAT_MAPPING LookupFormat(
       D3D9Format            Format) const;
 
@@ -988,6 +1051,10 @@ namespace dxvk {
 
     void UploadManagedTextures(uint32_t mask);
 
+    void QueueManagedUpload(D3D9CommonTexture* pResource);
+
+    void FlushManagedUploads();
+
     void GenerateTextureMips(uint32_t mask);
 
     void MarkTextureMipsDirty(D3D9CommonTexture* pResource);
@@ -1087,6 +1154,14 @@ namespace dxvk {
       UINT             PrimitiveCount,
       UINT             InstanceCount);
 
+    void CountMergeableDraw(
+            D3DPRIMITIVETYPE PrimitiveType,
+            INT              BaseVertexIndex,
+            UINT             MinVertexIndex,
+            UINT             NumVertices,
+            UINT             StartIndex,
+            UINT             PrimitiveCount);
+
     uint32_t GetInstanceCount() const;
 
     void PrepareDraw(D3DPRIMITIVETYPE PrimitiveType, bool UploadVBOs, bool UploadIBOs);
@@ -1178,6 +1253,11 @@ namespace dxvk {
      */
     void RemoveMappedTexture(D3D9CommonTexture* pTexture);
 
+    /**
+     * \brief Removes the texture from the list of pending managed uploads
+     */
+    void RemovePendingManagedUpload(D3D9CommonTexture* pTexture);
+
     /**
      * \brief Returns whether the device is currently recording a StateBlock
      */
@@ -1254,6 +1334,24 @@ namespace dxvk {
       return m_swvpEmulator.GetShaderCount();
     }
 
+    /**
+     * \brief Returns the number of indexed draws in the last frame that
+     * only differed from the previous draw in vertex shader constants.
+     */
+    UINT GetMergeableDrawCount() const {
+      return m_mergeableDrawsLastFrame.load();
+    }
+
+    /**
+     * \brief Enables mergeable draw detection
+     *
+     * Only done when the HUD item is active, so that
+     * regular draws do not pay for the detection.
+     */
+    void EnableMergeableDrawTracking() {
+      m_trackMergeableDraws = true;
+    }
+
     void InjectCsChunk(
             DxvkCsChunkRef&&            Chunk,
             bool                        Synchronize);
@@ -1528,6 +1626,38 @@ namespace dxvk {
       m_mostRecentlyUsedSwapchain = m_implicitSwapchain.ptr();
     }
 
+    /**
+     * \brief Checks whether the previous draw could be repeated with the
+     * current state by only changing per-instance vertex data, i.e. vertex
+     * shader constants or fixed function transforms.
+     */
+    bool IsOnlyVertexDataDirty() const {
+      const D3D9DeviceFlags allowedFlags(
+        D3D9DeviceFlag::DirtyFFVertexData,
+        D3D9DeviceFlag::DirtyFFVertexBlend,
+        D3D9DeviceFlag::InScene,
+        D3D9DeviceFlag::ValidSampleMask);
+
+      // Only consider state that got dirtied since the last draw
+      const D3D9DrawDirtyState& last = m_lastDrawDirtyState;
+
+      auto newFlags = m_flags.raw() & ~last.flags.raw();
+
+      return !(newFlags & ~allowedFlags.raw())
+          && !(m_textureSlotTracking.textureDirty & ~last.textureDirty)
+          && !(m_textureSlotTracking.samplerStateDirty & ~last.samplerStateDirty)
+          && !(m_consts[DxsoProgramType::PixelShader].dirty && !last.psConstantsDirty);
+    }
+
+    void StoreMergeableDrawState() {
+      m_lastIndexedDraw = m_currentIndexedDraw;
+
+      m_lastDrawDirtyState.flags             = m_flags;
+      m_lastDrawDirtyState.textureDirty      = m_textureSlotTracking.textureDirty;
+      m_lastDrawDirtyState.samplerStateDirty = m_textureSlotTracking.samplerStateDirty;
+      m_lastDrawDirtyState.psConstantsDirty  = m_consts[DxsoProgramType::PixelShader].dirty;
+    }
+
     bool IsTextureBoundAsAttachment(const D3D9CommonTexture* pTexture) const {
       if (unlikely(pTexture->IsRenderTarget())) {
         for (uint32_t i = 0u; i < m_state.renderTargets.size(); i++) {
@@ -1575,6 +1705,11 @@ namespace dxvk {
     D3D9Adapter*                    m_adapter;
     Rc<DxvkDevice>                  m_dxvkDevice;
 
+    // Services small DISCARD renames of dynamic buffers without
+    // going through the shared allocator. Only valid for buffers
+    // with the memory properties it was created for.
+    DxvkLocalAllocationCache        m_discardAllocationCache;
+
     D3D9MemoryAllocator             m_memoryAllocator;
 
     // Second memory allocator used for D3D9 shader bytecode.
@@ -1629,6 +1764,13 @@ namespace dxvk {
 
     D3D9DeviceFlags                 m_flags;
 
+    bool                            m_trackMergeableDraws = false;
+    D3D9IndexedDrawKey              m_currentIndexedDraw;
+    D3D9IndexedDrawKey              m_lastIndexedDraw;
+    D3D9DrawDirtyState              m_lastDrawDirtyState;
+    uint32_t                        m_mergeableDraws = 0;
+    std::atomic<uint32_t>           m_mergeableDrawsLastFrame = { 0u };
+
     D3D9TextureSlotTracking         m_textureSlotTracking;
 
     D3D9RTSlotTracking              m_rtSlotTracking;
@@ -1690,6 +1832,8 @@ namespace dxvk {
     lru_list<D3D9CommonTexture*>    m_mappedTextures;
 #endif
 
+    lru_list<D3D9CommonTexture*>    m_pendingManagedUploads;
+
     // m_state should be declared last (i.e. freed first), because it
     // references objects that can call back into the device when freed.
     Direct3DState9                  m_state;
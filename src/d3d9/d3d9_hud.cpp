@@ -76,6 +76,31 @@ namespace dxvk::hud {
   }
 
 
+  HudMergeableDraws::HudMergeableDraws(D3D9DeviceEx* device)
+  : m_device             (device)
+  , m_mergeableDrawCount ("") {}
+
+
+  void HudMergeableDraws::update(dxvk::high_resolution_clock::time_point time) {
+    m_mergeableDrawCount = str::format(m_device->GetMergeableDrawCount());
+  }
+
+
+  HudPos HudMergeableDraws::render(
+    const Rc<DxvkCommandList>&ctx,
+    const HudPipelineKey&     key,
+    const HudOptions&         options,
+          HudRenderer&        renderer,
+          HudPos              position) {
+    position.y += 16;
+    renderer.drawText(16, position, 0xffc0ff00u, "Mergeable draws:");
+    renderer.drawText(16, { position.x + 220, position.y }, 0xffffffffu, m_mergeableDrawCount);
+
+    position.y += 8;
+    return position;
+  }
+
+
   HudSWVPState::HudSWVPState(D3D9DeviceEx* device)
           : m_device          (device)
           , m_isSWVPText ("") {}
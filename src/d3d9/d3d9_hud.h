@@ -67,6 +67,34 @@ namespace dxvk::hud {
   };
 
 
+  /**
+   * \brief HUD item to display the number of draws that could
+   * have been merged into instanced draws in the last frame
+   */
+  class HudMergeableDraws : public HudItem {
+
+  public:
+
+    HudMergeableDraws(D3D9DeviceEx* device);
+
+    void update(dxvk::high_resolution_clock::time_point time);
+
+    HudPos render(
+      const Rc<DxvkCommandList>&ctx,
+      const HudPipelineKey&     key,
+      const HudOptions&         options,
+            HudRenderer&        renderer,
+            HudPos              position);
+
+  private:
+
+    D3D9DeviceEx* m_device;
+
+    std::string m_mergeableDrawCount;
+
+  };
+
+
   /**
    * \brief HUD item to whether or not we're in SWVP mode
    */
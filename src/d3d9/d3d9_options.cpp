@@ -74,6 +74,8 @@ namespace dxvk {
     this->countLosableResources         = config.getOption<bool>        ("d3d9.countLosableResources",         true);
     this->reproducibleCommandStream     = config.getOption<bool>        ("d3d9.reproducibleCommandStream",     false);
     this->extraFrontbuffer              = config.getOption<bool>        ("d3d9.extraFrontbuffer",              false);
+    this->eagerManagedUpload            = config.getOption<bool>        ("d3d9.eagerManagedUpload",            false);
+    this->predictOcclusionQueries       = config.getOption<bool>        ("d3d9.predictOcclusionQueries",       false);
 
     // D3D8 options
     this->drefScaling                   = config.getOption<int32_t>     ("d3d8.scaleDref",                     0);
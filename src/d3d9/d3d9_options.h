@@ -164,6 +164,14 @@ namespace dxvk {
 
     /// Add an extra front buffer to make GetFrontBufferData() work correctly when the swapchain only has a single buffer
     bool extraFrontbuffer;
+
+    /// Upload managed textures and generate their mips at the end of the
+    /// frame they were unlocked in, rather than on the draw that first uses them
+    bool eagerManagedUpload;
+
+    /// Return the last known occlusion query result instead
+    /// of S_FALSE while the actual result is still pending
+    bool predictOcclusionQueries;
   };
 
 }
@@ -24,6 +24,12 @@ namespace dxvk {
         m_query[0] = dxvkDevice->createGpuQuery(
           VK_QUERY_TYPE_OCCLUSION,
           VK_QUERY_CONTROL_PRECISE_BIT, 0);
+
+        if (m_parent->GetOptions()->predictOcclusionQueries) {
+          m_predictQuery = dxvkDevice->createGpuQuery(
+            VK_QUERY_TYPE_OCCLUSION,
+            VK_QUERY_CONTROL_PRECISE_BIT, 0);
+        }
         break;
 
       case D3DQUERYTYPE_TIMESTAMP:
@@ -177,7 +183,7 @@ namespace dxvk {
       this->Issue(D3DISSUE_END);
 
     if (m_resetCtr != 0u)
-      return S_FALSE;
+      return GetPredictedData(pData, dwSize);
 
     if (m_queryType == D3DQUERYTYPE_EVENT) {
       DxvkGpuEventStatus status = m_event[0]->test();
@@ -208,9 +214,12 @@ namespace dxvk {
           return D3DERR_INVALIDCALL;
 
         if (status == DxvkGpuQueryStatus::Pending)
-          return S_FALSE;
+          return GetPredictedData(pData, dwSize);
       }
 
+      if (m_predictQuery != nullptr)
+        m_lastOcclusion.store(DWORD(queryData[0].occlusion.samplesPassed), std::memory_order_relaxed);
+
       if (pData == nullptr)
         return D3D_OK;
 
@@ -252,6 +261,40 @@ namespace dxvk {
   }
 
 
+  HRESULT D3D9Query::GetPredictedData(void* pData, DWORD dwSize) {
+    if (m_predictQuery == nullptr)
+      return S_FALSE;
+
+    // Do not transition to the cached state here so that
+    // subsequent calls still pick up the actual result.
+    if (likely(pData && dwSize)) {
+      DWORD occlusion = m_lastOcclusion.load(std::memory_order_relaxed);
+      memcpy(pData, &occlusion, std::min<DWORD>(dwSize, sizeof(occlusion)));
+    }
+
+    return D3D_OK;
+  }
+
+
+  void D3D9Query::UpdatePrediction() {
+    // Called on the CS thread right before the query gets reset. Apps
+    // that consume predicted results may never read the actual result,
+    // so collect it here. If the query is still pending, keep it alive
+    // as the prediction query and reuse the older one for this pass.
+    DxvkQueryData queryData = { };
+
+    if (m_predictQuery->getData(queryData) == DxvkGpuQueryStatus::Available)
+      m_lastOcclusion.store(DWORD(queryData.occlusion.samplesPassed), std::memory_order_relaxed);
+
+    DxvkGpuQueryStatus status = m_query[0]->getData(queryData);
+
+    if (status == DxvkGpuQueryStatus::Available)
+      m_lastOcclusion.store(DWORD(queryData.occlusion.samplesPassed), std::memory_order_relaxed);
+    else if (status == DxvkGpuQueryStatus::Pending)
+      std::swap(m_query[0], m_predictQuery);
+  }
+
+
   UINT64 D3D9Query::GetTimestampQueryFrequency() const {
     Rc<DxvkDevice>  device  = m_parent->GetDXVKDevice();
     Rc<DxvkAdapter> adapter = device->adapter();
@@ -264,6 +307,9 @@ namespace dxvk {
   void D3D9Query::Begin(DxvkContext* ctx) {
     switch (m_queryType) {
       case D3DQUERYTYPE_OCCLUSION:
+        if (m_predictQuery != nullptr)
+          UpdatePrediction();
+
         ctx->beginQuery(m_query[0]);
         break;
 
@@ -84,6 +84,13 @@ namespace dxvk {
 
     D3D9_QUERY_DATA m_dataCache;
 
+    Rc<DxvkQuery>        m_predictQuery;
+    std::atomic<DWORD>   m_lastOcclusion = { ~0u };
+
+    HRESULT GetPredictedData(void* pData, DWORD dwSize);
+
+    void UpdatePrediction();
+
     UINT64 GetTimestampQueryFrequency() const;
 
   };
@@ -1,3 +1,5 @@
+#include "../util/util_time.h"
+
 #include "d3d9_shader.h"
 
 #include "d3d9_caps.h"
@@ -54,7 +56,11 @@ namespace dxvk {
     const D3D9ConstantLayout& constantLayout = ShaderStage == VK_SHADER_STAGE_VERTEX_BIT
       ? pDevice->GetVertexConstantLayout()
       : pDevice->GetPixelConstantLayout();
+
+    auto t0 = dxvk::high_resolution_clock::now();
     m_shader       = pModule->compile(*pDxsoModuleInfo, name, AnalysisInfo, constantLayout);
+    auto t1 = dxvk::high_resolution_clock::now();
+
     m_isgn         = pModule->isgn();
     m_usedSamplers = pModule->usedSamplers();
     m_textureTypes = pModule->textureTypes();
@@ -73,6 +79,8 @@ namespace dxvk {
     m_maxDefinedConst = pModule->maxDefinedConstant();
 
     m_shader->setShaderKey(Key);
+    m_shader->setTranslationStats(bytecodeLength,
+      std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
 
     if (dumpPath.size() != 0) {
       std::ofstream dumpStream(
@@ -184,8 +184,53 @@ namespace dxvk {
       Capture
     };
 
-    template <typename Dst, typename Src, bool IgnoreStreamOffset>
+    /**
+     * \brief Iterates over ranges of consecutive captured registers
+     *
+     * Registers for which \c filter returns \c false are skipped
+     * and split ranges, so that redundant values are not forwarded.
+     * \param [in] mask Capture mask
+     * \param [in] filter Per-register predicate
+     * \param [in] fn Callback taking the first register and count
+     */
+    template <size_t Bits, typename Filter, typename Fn>
+    static void ForEachCapturedRange(
+            bit::bitset<Bits>&  mask,
+      const Filter&             filter,
+      const Fn&                 fn) {
+      uint32_t start = 0;
+      uint32_t count = 0;
+
+      for (uint32_t i = 0; i < mask.dwordCount(); i++) {
+        for (uint32_t bit : bit::BitMask(mask.dword(i))) {
+          uint32_t idx = i * 32 + bit;
+
+          if (!filter(idx))
+            continue;
+
+          if (count && start + count == idx) {
+            count++;
+            continue;
+          }
+
+          if (count)
+            fn(start, count);
+
+          start = idx;
+          count = 1;
+        }
+      }
+
+      if (count)
+        fn(start, count);
+    }
+
+    template <typename Dst, typename Src, bool IgnoreStreamOffset, bool SkipRedundant>
     void ApplyOrCapture(Dst* dst, const Src* src) {
+      // When applying, values that match the current device state are
+      // not forwarded at all, and constants are set in ranges rather
+      // than one register at a time.
+
       if (m_captures.flags.test(D3D9CapturedStateFlag::StreamFreq)) {
         for (uint32_t idx : bit::BitMask(m_captures.streamFreq.dword(0)))
           dst->SetStreamSourceFreq(idx, src->streamFreq[idx]);
@@ -199,6 +244,11 @@ namespace dxvk {
           for (uint32_t rs : bit::BitMask(m_captures.renderStates.dword(i))) {
             uint32_t idx = i * 32 + rs;
 
+            if constexpr (SkipRedundant) {
+              if (m_deviceState->renderStates[idx] == src->renderStates[idx])
+                continue;
+            }
+
             dst->SetRenderState(D3DRENDERSTATETYPE(idx), src->renderStates[idx]);
           }
         }
@@ -206,8 +256,14 @@ namespace dxvk {
 
       if (m_captures.flags.test(D3D9CapturedStateFlag::SamplerStates)) {
         for (uint32_t samplerIdx : bit::BitMask(m_captures.samplers.dword(0))) {
-          for (uint32_t stateIdx : bit::BitMask(m_captures.samplerStates[samplerIdx].dword(0)))
+          for (uint32_t stateIdx : bit::BitMask(m_captures.samplerStates[samplerIdx].dword(0))) {
+            if constexpr (SkipRedundant) {
+              if (m_deviceState->samplerStates[samplerIdx][stateIdx] == src->samplerStates[samplerIdx][stateIdx])
+                continue;
+            }
+
             dst->SetStateSamplerState(samplerIdx, D3DSAMPLERSTATETYPE(stateIdx), src->samplerStates[samplerIdx][stateIdx]);
+          }
         }
       }
 
@@ -249,6 +305,11 @@ namespace dxvk {
           for (uint32_t trans : bit::BitMask(m_captures.transforms.dword(i))) {
             uint32_t idx = i * 32 + trans;
 
+            if constexpr (SkipRedundant) {
+              if (!std::memcmp(&m_deviceState->transforms[idx], &src->transforms[idx], sizeof(Matrix4)))
+                continue;
+            }
+
             dst->SetStateTransform(idx, reinterpret_cast<const D3DMATRIX*>(&src->transforms[idx]));
           }
         }
@@ -256,8 +317,14 @@ namespace dxvk {
 
       if (m_captures.flags.test(D3D9CapturedStateFlag::TextureStages)) {
         for (uint32_t stageIdx : bit::BitMask(m_captures.textureStages.dword(0))) {
-          for (uint32_t stateIdx : bit::BitMask(m_captures.textureStageStates[stageIdx].dword(0)))
+          for (uint32_t stateIdx : bit::BitMask(m_captures.textureStageStates[stageIdx].dword(0))) {
+            if constexpr (SkipRedundant) {
+              if (m_deviceState->textureStages[stageIdx][stateIdx] == src->textureStages[stageIdx][stateIdx])
+                continue;
+            }
+
             dst->SetStateTextureStageState(stageIdx, D3D9TextureStageStateTypes(stateIdx), src->textureStages[stageIdx][stateIdx]);
+          }
         }
       }
 
@@ -273,21 +340,27 @@ namespace dxvk {
       }
 
       if (m_captures.flags.test(D3D9CapturedStateFlag::VsConstants)) {
-        for (uint32_t i = 0; i < m_captures.vsConsts.fConsts.dwordCount(); i++) {
-          for (uint32_t consts : bit::BitMask(m_captures.vsConsts.fConsts.dword(i))) {
-            uint32_t idx = i * 32 + consts;
-
-            dst->SetVertexShaderConstantF(idx, reinterpret_cast<const float*>(&src->vsConsts->fConsts[idx]), 1);
-          }
-        }
-
-        for (uint32_t i = 0; i < m_captures.vsConsts.iConsts.dwordCount(); i++) {
-          for (uint32_t consts : bit::BitMask(m_captures.vsConsts.iConsts.dword(i))) {
-            uint32_t idx = i * 32 + consts;
-
-            dst->SetVertexShaderConstantI(idx, reinterpret_cast<const int*>(&src->vsConsts->iConsts[idx]), 1);
-          }
-        }
+        auto filterF = [&] (uint32_t idx) {
+          if constexpr (SkipRedundant)
+            return !!std::memcmp(&m_deviceState->vsConsts->fConsts[idx], &src->vsConsts->fConsts[idx], sizeof(Vector4));
+          else
+            return true;
+        };
+
+        ForEachCapturedRange(m_captures.vsConsts.fConsts, filterF, [&] (uint32_t start, uint32_t count) {
+          dst->SetVertexShaderConstantF(start, reinterpret_cast<const float*>(&src->vsConsts->fConsts[start]), count);
+        });
+
+        auto filterI = [&] (uint32_t idx) {
+          if constexpr (SkipRedundant)
+            return !!std::memcmp(&m_deviceState->vsConsts->iConsts[idx], &src->vsConsts->iConsts[idx], sizeof(Vector4i));
+          else
+            return true;
+        };
+
+        ForEachCapturedRange(m_captures.vsConsts.iConsts, filterI, [&] (uint32_t start, uint32_t count) {
+          dst->SetVertexShaderConstantI(start, reinterpret_cast<const int*>(&src->vsConsts->iConsts[start]), count);
+        });
 
         if (m_captures.vsConsts.bConsts.any()) {
           for (uint32_t i = 0; i < m_captures.vsConsts.bConsts.dwordCount(); i++)
@@ -296,21 +369,27 @@ namespace dxvk {
       }
 
       if (m_captures.flags.test(D3D9CapturedStateFlag::PsConstants)) {
-        for (uint32_t i = 0; i < m_captures.psConsts.fConsts.dwordCount(); i++) {
-          for (uint32_t consts : bit::BitMask(m_captures.psConsts.fConsts.dword(i))) {
-            uint32_t idx = i * 32 + consts;
-
-            dst->SetPixelShaderConstantF(idx, reinterpret_cast<const float*>(&src->psConsts->fConsts[idx]), 1);
-          }
-        }
-
-        for (uint32_t i = 0; i < m_captures.psConsts.iConsts.dwordCount(); i++) {
-          for (uint32_t consts : bit::BitMask(m_captures.psConsts.iConsts.dword(i))) {
-            uint32_t idx = i * 32 + consts;
-
-            dst->SetPixelShaderConstantI(idx, reinterpret_cast<const int*>(&src->psConsts->iConsts[idx]), 1);
-          }
-        }
+        auto filterF = [&] (uint32_t idx) {
+          if constexpr (SkipRedundant)
+            return !!std::memcmp(&m_deviceState->psConsts->fConsts[idx], &src->psConsts->fConsts[idx], sizeof(Vector4));
+          else
+            return true;
+        };
+
+        ForEachCapturedRange(m_captures.psConsts.fConsts, filterF, [&] (uint32_t start, uint32_t count) {
+          dst->SetPixelShaderConstantF(start, reinterpret_cast<const float*>(&src->psConsts->fConsts[start]), count);
+        });
+
+        auto filterI = [&] (uint32_t idx) {
+          if constexpr (SkipRedundant)
+            return !!std::memcmp(&m_deviceState->psConsts->iConsts[idx], &src->psConsts->iConsts[idx], sizeof(Vector4i));
+          else
+            return true;
+        };
+
+        ForEachCapturedRange(m_captures.psConsts.iConsts, filterI, [&] (uint32_t start, uint32_t count) {
+          dst->SetPixelShaderConstantI(start, reinterpret_cast<const int*>(&src->psConsts->iConsts[start]), count);
+        });
 
         if (m_captures.psConsts.bConsts.any()) {
           for (uint32_t i = 0; i < m_captures.psConsts.bConsts.dwordCount(); i++)
@@ -338,9 +417,9 @@ namespace dxvk {
     template <D3D9StateFunction Func, bool IgnoreStreamOffset>
     void ApplyOrCapture() {
       if      constexpr (Func == D3D9StateFunction::Apply)
-        ApplyOrCapture<D3D9DeviceEx, D3D9CapturableState, IgnoreStreamOffset>(m_parent, &m_state);
+        ApplyOrCapture<D3D9DeviceEx, D3D9CapturableState, IgnoreStreamOffset, true>(m_parent, &m_state);
       else if constexpr (Func == D3D9StateFunction::Capture)
-        ApplyOrCapture<D3D9StateBlock, D3D9DeviceState, IgnoreStreamOffset>(this, m_deviceState);
+        ApplyOrCapture<D3D9StateBlock, D3D9DeviceState, IgnoreStreamOffset, false>(this, m_deviceState);
     }
 
     template <
@@ -1068,6 +1068,9 @@ namespace dxvk {
       hud->addItem<hud::HudFixedFunctionShaders>("ffshaders", -1, m_parent);
       hud->addItem<hud::HudSWVPState>("swvp", -1, m_parent);
 
+      if (hud->addItem<hud::HudMergeableDraws>("mergeabledraws", -1, m_parent) != nullptr)
+        m_parent->EnableMergeableDrawTracking();
+
 #ifdef D3D9_ALLOW_UNMAPPING
       hud->addItem<hud::HudTextureMemory>("memory", -1, m_parent);
 #endif
@@ -6123,42 +6123,56 @@ namespace dxvk {
           DxbcRegMask             writeMask) {
     if (reg.type == DxbcOperandType::Imm32
      || reg.type == DxbcOperandType::Imm64) {
-      DxbcRegisterValue result;
-      
+      // Declare 32-bit constants with the requested type directly, so
+      // that we do not emit bitcasts or composite constructs for them
+      // in the function body. 64-bit types still need to be cast.
+      DxbcScalarType ctype = DxbcScalarType::Uint32;
+
+      if (reg.dataType == DxbcScalarType::Float32
+       || reg.dataType == DxbcScalarType::Sint32)
+        ctype = reg.dataType;
+
+      auto defConstant = [this, ctype] (uint32_t value) {
+        switch (ctype) {
+          case DxbcScalarType::Float32: return m_module.constf32(bit::cast<float>(value));
+          case DxbcScalarType::Sint32:  return m_module.consti32(int32_t(value));
+          default:                      return m_module.constu32(value);
+        }
+      };
+
+      std::array<uint32_t, 4> indices = { };
+      uint32_t indexId = 0;
+
       if (reg.componentCount == DxbcComponentCount::Component1) {
-        // Create one single u32 constant
-        result.type.ctype  = DxbcScalarType::Uint32;
-        result.type.ccount = 1;
-        result.id = m_module.constu32(reg.imm.u32_1);
+        // Replicate the scalar constant as necessary
+        uint32_t constantId = defConstant(reg.imm.u32_1);
+
+        uint32_t count = std::max(writeMask.popCount(), 1u);
 
-        result = emitRegisterExtend(result, writeMask.popCount());
+        for (uint32_t i = 0; i < count; i++)
+          indices.at(indexId++) = constantId;
       } else if (reg.componentCount == DxbcComponentCount::Component4) {
-        // Create a u32 vector with as many components as needed
-        std::array<uint32_t, 4> indices = { };
-        uint32_t indexId = 0;
-        
+        // Create a vector with as many components as needed
         for (uint32_t i = 0; i < indices.size(); i++) {
-          if (writeMask[i]) {
-            indices.at(indexId++) =
-              m_module.constu32(reg.imm.u32_4[i]);
-          }
-        }
-        
-        result.type.ctype  = DxbcScalarType::Uint32;
-        result.type.ccount = writeMask.popCount();
-        result.id = indices.at(0);
-        
-        if (indexId > 1) {
-          result.id = m_module.constComposite(
-            getVectorTypeId(result.type),
-            result.type.ccount, indices.data());
+          if (writeMask[i])
+            indices.at(indexId++) = defConstant(reg.imm.u32_4[i]);
         }
-        
       } else {
         // Something went horribly wrong in the decoder or the shader is broken
         throw DxvkError("DxbcCompiler: Invalid component count for immediate operand");
       }
-      
+
+      DxbcRegisterValue result;
+      result.type.ctype  = ctype;
+      result.type.ccount = indexId;
+      result.id = indices.at(0);
+
+      if (indexId > 1) {
+        result.id = m_module.constComposite(
+          getVectorTypeId(result.type),
+          result.type.ccount, indices.data());
+      }
+
       // Cast constants to the requested type
       return emitRegisterBitcast(result, reg.dataType);
     } else if (reg.type == DxbcOperandType::ConstantBuffer) {
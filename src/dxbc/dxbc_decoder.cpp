@@ -2,42 +2,11 @@
 
 namespace dxvk {
   
-  const uint32_t* DxbcCodeSlice::ptrAt(uint32_t id) const {
-    if (m_ptr + id >= m_end)
-      throw DxvkError("DxbcCodeSlice: End of stream");
-    return m_ptr + id;
+  void DxbcCodeSlice::throwEndOfStream() {
+    throw DxvkError("DxbcCodeSlice: End of stream");
   }
   
   
-  uint32_t DxbcCodeSlice::at(uint32_t id) const {
-    if (m_ptr + id >= m_end)
-      throw DxvkError("DxbcCodeSlice: End of stream");
-    return m_ptr[id];
-  }
-  
-  
-  uint32_t DxbcCodeSlice::read() {
-    if (m_ptr >= m_end)
-      throw DxvkError("DxbcCodeSlice: End of stream");
-    return *(m_ptr++);
-  }
-  
-  
-  DxbcCodeSlice DxbcCodeSlice::take(uint32_t n) const {
-    if (m_ptr + n > m_end)
-      throw DxvkError("DxbcCodeSlice: End of stream");
-    return DxbcCodeSlice(m_ptr, m_ptr + n);
-  }
-  
-  
-  DxbcCodeSlice DxbcCodeSlice::skip(uint32_t n) const {
-    if (m_ptr + n > m_end)
-      throw DxvkError("DxbcCodeSlice: End of stream");
-    return DxbcCodeSlice(m_ptr + n, m_end);
-  }
-  
-  
-  
   void DxbcDecodeContext::decodeInstruction(DxbcCodeSlice& code) {
     const uint32_t token0 = code.at(0);
     
@@ -148,7 +117,7 @@ namespace dxvk {
     // Retrieve the instruction format in order to parse the
     // operands. Doing this mostly automatically means that
     // the compiler can rely on the operands being valid.
-    const DxbcInstFormat format = dxbcInstructionFormat(m_instruction.op);
+    const DxbcInstFormat& format = dxbcInstructionFormat(m_instruction.op);
     m_instruction.opClass = format.instructionClass;
     
     for (uint32_t i = 0; i < format.operandCount; i++)
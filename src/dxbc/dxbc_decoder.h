@@ -428,13 +428,35 @@ namespace dxvk {
       const uint32_t* end)
     : m_ptr(ptr), m_end(end) { }
     
-    const uint32_t* ptrAt(uint32_t id) const;
+    const uint32_t* ptrAt(uint32_t id) const {
+      if (unlikely(m_ptr + id >= m_end))
+        throwEndOfStream();
+      return m_ptr + id;
+    }
+    
+    uint32_t at(uint32_t id) const {
+      if (unlikely(m_ptr + id >= m_end))
+        throwEndOfStream();
+      return m_ptr[id];
+    }
+    
+    uint32_t read() {
+      if (unlikely(m_ptr >= m_end))
+        throwEndOfStream();
+      return *(m_ptr++);
+    }
     
-    uint32_t at(uint32_t id) const;
-    uint32_t read();
+    DxbcCodeSlice take(uint32_t n) const {
+      if (unlikely(m_ptr + n > m_end))
+        throwEndOfStream();
+      return DxbcCodeSlice(m_ptr, m_ptr + n);
+    }
     
-    DxbcCodeSlice take(uint32_t n) const;
-    DxbcCodeSlice skip(uint32_t n) const;
+    DxbcCodeSlice skip(uint32_t n) const {
+      if (unlikely(m_ptr + n > m_end))
+        throwEndOfStream();
+      return DxbcCodeSlice(m_ptr + n, m_end);
+    }
     
     bool atEnd() const {
       return m_ptr == m_end;
@@ -444,6 +466,8 @@ namespace dxvk {
     
     const uint32_t* m_ptr = nullptr;
     const uint32_t* m_end = nullptr;
+
+    [[noreturn]] static void throwEndOfStream();
     
   };
   
@@ -99,6 +99,6 @@ namespace dxvk {
    * \param [in] opcode The opcode to retrieve
    * \returns Instruction format info
    */
-  DxbcInstFormat dxbcInstructionFormat(DxbcOpcode opcode);
+  const DxbcInstFormat& dxbcInstructionFormat(DxbcOpcode opcode);
   
 }
\ No newline at end of file
@@ -1649,27 +1649,36 @@ namespace dxvk {
   DxsoRegisterValue DxsoCompiler::emitSrcOperandPostSwizzleModifiers(
             DxsoRegisterValue       value,
             DxsoRegModifier         modifier) {
+    // Negated variants of the bias, sign and x2 modifiers are folded
+    // into a single instruction rather than emitting an extra negate.
+    bool negate = modifier == DxsoRegModifier::BiasNeg
+               || modifier == DxsoRegModifier::SignNeg
+               || modifier == DxsoRegModifier::X2Neg;
+
     // r - 0.5
+    // 0.5 - r
     if (modifier == DxsoRegModifier::Bias
      || modifier == DxsoRegModifier::BiasNeg) {
       uint32_t halfVec = m_module.constfReplicant(
         0.5f, value.type.ccount);
 
-      value.id = m_module.opFSub(
-        getVectorTypeId(value.type), value.id, halfVec);
+      value.id = negate
+        ? m_module.opFSub(getVectorTypeId(value.type), halfVec, value.id)
+        : m_module.opFSub(getVectorTypeId(value.type), value.id, halfVec);
     }
 
     // fma(r, 2.0f, -1.0f)
+    // fma(r, -2.0f, 1.0f)
     if (modifier == DxsoRegModifier::Sign
      || modifier == DxsoRegModifier::SignNeg) {
-      uint32_t twoVec = m_module.constfReplicant(
-        2.0f, value.type.ccount);
+      uint32_t scaleVec = m_module.constfReplicant(
+        negate ? -2.0f : 2.0f, value.type.ccount);
 
-      uint32_t minusOneVec = m_module.constfReplicant(
-        -1.0f, value.type.ccount);
+      uint32_t biasVec = m_module.constfReplicant(
+        negate ? 1.0f : -1.0f, value.type.ccount);
 
       value.id = m_module.opFFma(
-        getVectorTypeId(value.type), value.id, twoVec, minusOneVec);
+        getVectorTypeId(value.type), value.id, scaleVec, biasVec);
     }
 
     // 1 - r
@@ -1682,13 +1691,14 @@ namespace dxvk {
     }
 
     // r * 2
+    // r * -2
     if (modifier == DxsoRegModifier::X2
      || modifier == DxsoRegModifier::X2Neg) {
-      uint32_t twoVec = m_module.constfReplicant(
-        2.0f, value.type.ccount);
+      uint32_t scaleVec = m_module.constfReplicant(
+        negate ? -2.0f : 2.0f, value.type.ccount);
 
       value.id = m_module.opFMul(
-        getVectorTypeId(value.type), value.id, twoVec);
+        getVectorTypeId(value.type), value.id, scaleVec);
     }
 
     // abs( r )
@@ -1705,14 +1715,8 @@ namespace dxvk {
     }
 
     // -r
-    // Treating as -r
-    // Treating as -r
-    // -r * 2
     // -abs(r)
     if (modifier == DxsoRegModifier::Neg
-     || modifier == DxsoRegModifier::BiasNeg
-     || modifier == DxsoRegModifier::SignNeg
-     || modifier == DxsoRegModifier::X2Neg
      || modifier == DxsoRegModifier::AbsNeg) {
       value.id = m_module.opFNegate(
         getVectorTypeId(value.type), value.id);
@@ -78,7 +78,14 @@ namespace dxvk {
   
   DxvkComputePipelineInstance* DxvkComputePipeline::createInstance(
     const DxvkComputePipelineStateInfo& state) {
+    auto t0 = dxvk::high_resolution_clock::now();
     VkPipeline newPipelineHandle = this->createPipeline(state);
+    auto t1 = dxvk::high_resolution_clock::now();
+
+    if (newPipelineHandle) {
+      m_shaders.cs->notifyPipelineCompile(
+        std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
+    }
 
     m_stats->numComputePipelines += 1;
     return &(*m_pipelines.emplace(state, newPipelineHandle));
@@ -1431,6 +1431,9 @@ namespace dxvk {
     Rc<DxvkResourceAllocation> prevAllocation = buffer->assignStorage(std::move(slice));
     m_cmd->track(std::move(prevAllocation));
 
+    m_cmd->addStatCtr(DxvkStatCounter::CmdBufferRenameCount, 1u);
+    m_cmd->addStatCtr(DxvkStatCounter::CmdBufferRenameBytes, buffer->info().size);
+
     buffer->resetTracking();
 
     // We also need to update all bindings that the buffer
@@ -42,6 +42,7 @@ namespace dxvk {
     // Stop workers explicitly in order to prevent
     // access to structures that are being destroyed.
     m_objects.pipelineManager().stopWorkerThreads();
+    m_objects.pipelineManager().writeShaderStats();
   }
 
 
@@ -457,6 +458,7 @@ namespace dxvk {
     result.setCtr(DxvkStatCounter::PipeCountGraphics, pipe.numGraphicsPipelines);
     result.setCtr(DxvkStatCounter::PipeCountLibrary,  pipe.numGraphicsLibraries);
     result.setCtr(DxvkStatCounter::PipeCountCompute,  pipe.numComputePipelines);
+    result.setCtr(DxvkStatCounter::PipeCountSpecVariants, pipe.numSpecConstantVariants);
     result.setCtr(DxvkStatCounter::PipeTasksDone,     workers.tasksCompleted);
     result.setCtr(DxvkStatCounter::PipeTasksTotal,    workers.tasksTotal);
     result.setCtr(DxvkStatCounter::GpuIdleTicks,      m_submissionQueue.gpuIdleTicks());
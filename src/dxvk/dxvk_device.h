@@ -492,6 +492,16 @@ namespace dxvk {
       return m_objects.descriptors();
     }
 
+    /**
+     * \brief Queries the most expensive shaders
+     *
+     * \param [in] count Maximum number of shaders
+     * \returns Shader statistics, most expensive first
+     */
+    std::vector<DxvkShaderStatsEntry> getShaderStats(uint32_t count) {
+      return m_objects.pipelineManager().getShaderStats(count);
+    }
+
     /**
      * \brief Queries sampler statistics
      * \returns Sampler stats
@@ -1190,9 +1190,29 @@ namespace dxvk {
     if (!fastHandle && !baseHandle)
       this->logPipelineState(LogLevel::Error, state);
 
+    // Track instances that only exist because spec constants changed,
+    // so that excessive spec constant churn can be spotted in the HUD
+    if (m_specConstantMask && isSpecConstantVariant(state))
+      m_stats->numSpecConstantVariants += 1;
+
     m_stats->numGraphicsPipelines += 1;
     return &(*m_pipelines.emplace(state, baseHandle, fastHandle, computeAttachmentMask(state)));
   }
+
+
+  bool DxvkGraphicsPipeline::isSpecConstantVariant(
+    const DxvkGraphicsPipelineStateInfo& state) const {
+    DxvkGraphicsPipelineStateInfo copy(state);
+
+    for (const auto& instance : m_pipelines) {
+      copy.sc = instance.state.sc;
+
+      if (instance.state == copy)
+        return true;
+    }
+
+    return false;
+  }
   
   
   DxvkGraphicsPipelineInstance* DxvkGraphicsPipeline::findInstance(
@@ -1379,11 +1399,22 @@ namespace dxvk {
     // Keep pipeline locked to prevent multiple threads from compiling
     // identical Vulkan pipelines. This should be rare, but has been
     // buggy on some drivers in the past, so just don't allow it.
+    auto t0 = dxvk::high_resolution_clock::now();
     VkPipeline handle = createOptimizedPipeline(key);
+    auto t1 = dxvk::high_resolution_clock::now();
 
-    if (handle)
+    if (handle) {
       m_fastPipelines.insert({ key, handle });
 
+      uint64_t time = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+
+      for (auto shader : { m_shaders.vs.ptr(), m_shaders.tcs.ptr(),
+          m_shaders.tes.ptr(), m_shaders.gs.ptr(), m_shaders.fs.ptr() }) {
+        if (shader)
+          shader->notifyPipelineCompile(time);
+      }
+    }
+
     return handle;
   }
 
@@ -637,6 +637,9 @@ namespace dxvk {
     DxvkGraphicsPipelineInstance* findInstance(
       const DxvkGraphicsPipelineStateInfo& state);
 
+    bool isSpecConstantVariant(
+      const DxvkGraphicsPipelineStateInfo& state) const;
+
     bool canCreateBasePipeline(
       const DxvkGraphicsPipelineStateInfo& state) const;
 
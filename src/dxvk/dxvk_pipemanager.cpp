@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <fstream>
 #include <optional>
 
 #include "dxvk_device.h"
@@ -306,6 +308,10 @@ namespace dxvk {
   
   void DxvkPipelineManager::registerShader(
     const Rc<DxvkShader>&         shader) {
+    { std::lock_guard lock(m_shaderStatsMutex);
+      m_shaderStatsList.push_back(shader);
+    }
+
     if (canPrecompileShader(shader)) {
       DxvkShaderPipelineLibraryKey key;
       key.addShader(shader);
@@ -341,10 +347,77 @@ namespace dxvk {
     result.numGraphicsPipelines = m_stats.numGraphicsPipelines.load();
     result.numGraphicsLibraries = m_stats.numGraphicsLibraries.load();
     result.numComputePipelines  = m_stats.numComputePipelines.load();
+    result.numSpecConstantVariants = m_stats.numSpecConstantVariants.load();
+    return result;
+  }
+
+
+  std::vector<DxvkShaderStatsEntry> DxvkPipelineManager::getShaderStats(
+          uint32_t                count) {
+    std::vector<std::pair<uint64_t, const DxvkShader*>> shaders;
+
+    { std::lock_guard lock(m_shaderStatsMutex);
+      shaders.reserve(m_shaderStatsList.size());
+
+      for (const auto& shader : m_shaderStatsList) {
+        DxvkShaderStats stats = shader->getStats();
+        shaders.push_back({ stats.translationTime + stats.pipelineTime, shader.ptr() });
+      }
+
+      count = std::min<size_t>(count, shaders.size());
+
+      std::partial_sort(shaders.begin(), shaders.begin() + count, shaders.end(),
+        [] (const auto& a, const auto& b) { return a.first > b.first; });
+    }
+
+    // Shaders are kept alive by the list until the device gets
+    // destroyed, so it is safe to access them without the lock
+    std::vector<DxvkShaderStatsEntry> result(count);
+
+    for (uint32_t i = 0; i < count; i++) {
+      result[i].name = shaders[i].second->debugName();
+      result[i].stats = shaders[i].second->getStats();
+    }
+
     return result;
   }
 
 
+  void DxvkPipelineManager::writeShaderStats() {
+    std::string path = env::getEnvVar("DXVK_SHADER_STATS_PATH");
+
+    if (path.empty())
+      return;
+
+    std::ofstream file(str::topath(str::format(path, "/dxvk_shader_stats.csv").c_str()).c_str(),
+      std::ios_base::app);
+
+    if (!file) {
+      Logger::warn(str::format("DxvkPipelineManager: Failed to open shader stats file in ", path));
+      return;
+    }
+
+    // Only write the header if we're not appending to an existing file
+    file.seekp(0, std::ios_base::end);
+
+    if (file.tellp() == 0)
+      file << "shader,bytecode_size,spirv_size,translation_us,pipelines,pipeline_us" << std::endl;
+
+    std::lock_guard lock(m_shaderStatsMutex);
+
+    for (const auto& shader : m_shaderStatsList) {
+      DxvkShaderStats stats = shader->getStats();
+
+      file << shader->debugName() << ","
+           << stats.bytecodeSize << ","
+           << stats.spirvSize << ","
+           << stats.translationTime << ","
+           << stats.pipelineCount << ","
+           << stats.pipelineTime << "\n";
+    }
+  }
+
+
   void DxvkPipelineManager::stopWorkerThreads() {
     m_workers.stopWorkers();
   }
@@ -22,6 +22,7 @@ namespace dxvk {
     uint32_t numGraphicsPipelines;
     uint32_t numGraphicsLibraries;
     uint32_t numComputePipelines;
+    uint32_t numSpecConstantVariants;
   };
 
   /**
@@ -31,6 +32,15 @@ namespace dxvk {
     std::atomic<uint32_t> numGraphicsPipelines  = { 0u };
     std::atomic<uint32_t> numGraphicsLibraries  = { 0u };
     std::atomic<uint32_t> numComputePipelines   = { 0u };
+    std::atomic<uint32_t> numSpecConstantVariants = { 0u };
+  };
+
+  /**
+   * \brief Shader cost statistics entry
+   */
+  struct DxvkShaderStatsEntry {
+    std::string     name;
+    DxvkShaderStats stats;
   };
 
   struct DxvkPipelineWorkerStats {
@@ -268,6 +278,25 @@ namespace dxvk {
      */
     DxvkPipelineCount getPipelineCount() const;
 
+    /**
+     * \brief Retrieves the most expensive shaders
+     *
+     * Shaders are ranked by the total time spent translating
+     * them and compiling pipelines or libraries using them.
+     * \param [in] count Maximum number of shaders to return
+     * \returns Shader statistics, most expensive first
+     */
+    std::vector<DxvkShaderStatsEntry> getShaderStats(
+            uint32_t                count);
+
+    /**
+     * \brief Writes shader statistics to a file
+     *
+     * Appends one line per registered shader to the file
+     * in \c DXVK_SHADER_STATS_PATH, if that is set.
+     */
+    void writeShaderStats();
+
     /**
      * \brief Checks whether async compiler is busy
      * \returns \c true if shaders are being compiled
@@ -288,6 +317,9 @@ namespace dxvk {
     DxvkPipelineStats         m_stats;
     
     dxvk::mutex m_mutex;
+
+    dxvk::mutex                 m_shaderStatsMutex;
+    std::vector<Rc<DxvkShader>> m_shaderStatsList;
     
     std::unordered_map<
       DxvkDescriptorSetLayoutKey,
@@ -1,3 +1,5 @@
+#include "../util/util_time.h"
+
 #include "dxvk_device.h"
 #include "dxvk_pipemanager.h"
 #include "dxvk_shader.h"
@@ -46,7 +48,7 @@ namespace dxvk {
   DxvkShader::DxvkShader(
     const DxvkShaderCreateInfo&   info,
           SpirvCodeBuffer&&       spirv)
-  : m_info(info), m_code(spirv), m_layout(info.stage) {
+  : m_info(info), m_code(spirv), m_codeSize(spirv.size()), m_layout(info.stage) {
     m_info.bindings = nullptr;
 
     // Copy resource binding slot infos
@@ -63,6 +65,8 @@ namespace dxvk {
     std::vector<uint32_t> varIds;
     std::vector<uint32_t> sampleMaskIds;
     std::unordered_map<uint32_t, uint32_t> pushConstantTypes;
+    std::unordered_map<uint32_t, uint32_t> varLocations;
+    std::unordered_map<uint32_t, uint32_t> inputLocations;
 
     SpirvCodeBuffer code = std::move(spirv);
     uint32_t o1VarId = 0;
@@ -96,6 +100,9 @@ namespace dxvk {
             m_specConstantMask |= 1u << ins.arg(3);
         }
 
+        if (ins.arg(2) == spv::DecorationLocation)
+          varLocations.insert({ ins.arg(1), ins.arg(3) });
+
         if (ins.arg(2) == spv::DecorationLocation && ins.arg(3) == 1) {
           m_o1LocOffset = ins.offset() + 3;
           o1VarId = ins.arg(1);
@@ -144,6 +151,13 @@ namespace dxvk {
             m_flags.set(DxvkShaderFlag::ExportsSampleMask);
         }
 
+        if (ins.arg(3) == spv::StorageClassInput) {
+          auto location = varLocations.find(ins.arg(2));
+
+          if (location != varLocations.end())
+            inputLocations.insert({ ins.arg(2), location->second });
+        }
+
         if (ins.arg(3) == spv::StorageClassPushConstant) {
           auto type = pushConstantTypes.find(ins.arg(1));
 
@@ -176,6 +190,21 @@ namespace dxvk {
         break;
     }
 
+    // Find input variables that are accessed through access chains, since
+    // eliminating those requires patching the actual function code. This
+    // avoids scanning the entire shader for every undefined input later.
+    if (!inputLocations.empty()) {
+      for (auto ins : code) {
+        if (ins.opCode() == spv::OpAccessChain
+         || ins.opCode() == spv::OpInBoundsAccessChain) {
+          auto location = inputLocations.find(ins.arg(3));
+
+          if (location != inputLocations.end() && location->second < 32u)
+            m_inputAccessChainMask |= 1u << location->second;
+        }
+      }
+    }
+
     // Combine spec constant IDs with other binding info
     for (auto varId : varIds) {
       BindingOffsets info = bindingOffsets[varId];
@@ -220,6 +249,17 @@ namespace dxvk {
   DxvkShader::~DxvkShader() {
     
   }
+
+
+  DxvkShaderStats DxvkShader::getStats() const {
+    DxvkShaderStats stats;
+    stats.bytecodeSize = m_bytecodeSize;
+    stats.spirvSize = m_codeSize;
+    stats.translationTime = m_translationTime;
+    stats.pipelineCount = m_pipelineCount.load(std::memory_order_relaxed);
+    stats.pipelineTime = m_pipelineTime.load(std::memory_order_relaxed);
+    return stats;
+  }
   
   
   SpirvCodeBuffer DxvkShader::getCode(
@@ -257,7 +297,7 @@ namespace dxvk {
     
     // Replace undefined input variables with zero
     for (uint32_t u : bit::BitMask(state.undefinedInputs))
-      eliminateInput(spirvCode, u);
+      eliminateInput(spirvCode, u, (m_inputAccessChainMask >> u) & 1u);
 
     // Patch primitive topology as necessary
     if (m_info.stage == VK_SHADER_STAGE_GEOMETRY_BIT
@@ -317,7 +357,7 @@ namespace dxvk {
   }
 
 
-  void DxvkShader::eliminateInput(SpirvCodeBuffer& code, uint32_t location) {
+  void DxvkShader::eliminateInput(SpirvCodeBuffer& code, uint32_t location, bool hasAccessChains) {
     struct SpirvTypeInfo {
       spv::Op           op            = spv::OpNop;
       uint32_t          baseTypeId    = 0;
@@ -508,6 +548,9 @@ namespace dxvk {
     }
 
     // Fix up pointer types used in access chain instructions
+    if (!hasAccessChains)
+      return;
+
     std::unordered_map<uint32_t, uint32_t> accessChainIds;
 
     for (auto ins : code) {
@@ -1439,6 +1482,8 @@ namespace dxvk {
     // so that we don't have to decompress our SPIR-V shader again.
     DxvkShaderPipelineLibraryHandle pipeline = { VK_NULL_HANDLE, 0 };
 
+    auto t0 = dxvk::high_resolution_clock::now();
+
     if (m_compiledOnce && canUsePipelineCacheControl())
       pipeline = this->compileShaderPipeline(VK_PIPELINE_CREATE_2_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT);
 
@@ -1449,6 +1494,15 @@ namespace dxvk {
     if (!pipeline.handle)
       return { VK_NULL_HANDLE, 0 };
 
+    uint64_t time = std::chrono::duration_cast<std::chrono::microseconds>(
+      dxvk::high_resolution_clock::now() - t0).count();
+
+    for (auto shader : { m_shaders.vs, m_shaders.tcs, m_shaders.tes,
+        m_shaders.gs, m_shaders.fs, m_shaders.cs }) {
+      if (shader)
+        shader->notifyPipelineCompile(time);
+    }
+
     // Increment stat counter the first time this
     // shader pipeline gets compiled successfully
     if (!m_compiledOnce) {
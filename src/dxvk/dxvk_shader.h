@@ -85,6 +85,27 @@ namespace dxvk {
 
     size_t hash() const;
   };
+
+
+  /**
+   * \brief Shader cost statistics
+   *
+   * Gathered over the lifetime of a shader in order
+   * to find shaders that are expensive to translate
+   * or to compile into pipelines.
+   */
+  struct DxvkShaderStats {
+    /// Size of the source bytecode, in bytes
+    size_t   bytecodeSize = 0;
+    /// Size of the generated SPIR-V, in bytes
+    size_t   spirvSize = 0;
+    /// Time spent translating the shader, in microseconds
+    uint64_t translationTime = 0;
+    /// Number of pipelines or libraries compiled with the shader
+    uint32_t pipelineCount = 0;
+    /// Time spent compiling those pipelines, in microseconds
+    uint64_t pipelineTime = 0;
+  };
   
   
   /**
@@ -236,6 +257,37 @@ namespace dxvk {
       return m_key.toString();
     }
 
+    /**
+     * \brief Records translation cost
+     *
+     * Called by the front-end after the shader has been
+     * translated from its original bytecode.
+     * \param [in] bytecodeSize Source bytecode size, in bytes
+     * \param [in] time Translation time, in microseconds
+     */
+    void setTranslationStats(size_t bytecodeSize, uint64_t time) {
+      m_bytecodeSize = bytecodeSize;
+      m_translationTime = time;
+    }
+
+    /**
+     * \brief Notifies pipeline compile
+     *
+     * Called whenever a pipeline or pipeline library that
+     * uses this shader has been compiled. Thread-safe.
+     * \param [in] time Compile time, in microseconds
+     */
+    void notifyPipelineCompile(uint64_t time) {
+      m_pipelineCount.fetch_add(1u, std::memory_order_relaxed);
+      m_pipelineTime.fetch_add(time, std::memory_order_relaxed);
+    }
+
+    /**
+     * \brief Queries shader cost statistics
+     * \returns Current statistics
+     */
+    DxvkShaderStats getStats() const;
+
     /**
      * \brief Get lookup hash for a shader
      *
@@ -264,6 +316,7 @@ namespace dxvk {
 
     DxvkShaderCreateInfo          m_info;
     SpirvCompressedBuffer         m_code;
+    size_t                        m_codeSize = 0;
     
     DxvkShaderFlags               m_flags;
     DxvkShaderKey                 m_key;
@@ -273,8 +326,14 @@ namespace dxvk {
     size_t                        m_o1LocOffset = 0;
 
     uint32_t                      m_specConstantMask = 0;
+    uint32_t                      m_inputAccessChainMask = 0;
     std::atomic<bool>             m_needsLibraryCompile = { true };
 
+    size_t                        m_bytecodeSize = 0;
+    uint64_t                      m_translationTime = 0;
+    std::atomic<uint32_t>         m_pipelineCount = { 0u };
+    std::atomic<uint64_t>         m_pipelineTime = { 0u };
+
     std::vector<BindingOffsets>   m_bindingOffsets;
     std::vector<PushDataOffsets>  m_pushDataOffsets;
 
@@ -282,7 +341,8 @@ namespace dxvk {
 
     static void eliminateInput(
             SpirvCodeBuffer&          code,
-            uint32_t                  location);
+            uint32_t                  location,
+            bool                      hasAccessChains);
 
     static void emitOutputSwizzles(
             SpirvCodeBuffer&          code,
@@ -16,9 +16,12 @@ namespace dxvk {
     CmdDispatchCalls,         ///< Number of compute calls
     CmdRenderPassCount,       ///< Number of render passes
     CmdBarrierCount,          ///< Number of pipeline barriers
+    CmdBufferRenameCount,     ///< Number of buffer invalidations
+    CmdBufferRenameBytes,     ///< Amount of buffer memory renamed
     PipeCountGraphics,        ///< Number of graphics pipelines
     PipeCountLibrary,         ///< Number of graphics shader libraries
     PipeCountCompute,         ///< Number of compute pipelines
+    PipeCountSpecVariants,    ///< Graphics pipelines created for new spec constants
     PipeTasksDone,            ///< Boolean indicating compiler activity
     PipeTasksTotal,           ///< Boolean indicating compiler activity
     QueueSubmitCount,         ///< Number of command buffer submissions
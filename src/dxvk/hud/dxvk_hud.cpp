@@ -21,6 +21,7 @@ namespace dxvk::hud {
     addItem<HudSubmissionStatsItem>("submissions", -1, device);
     addItem<HudDrawCallStatsItem>("drawcalls", -1, device);
     addItem<HudPipelineStatsItem>("pipelines", -1, device);
+    addItem<HudShaderStatsItem>("shaderstats", -1, device);
     addItem<HudDescriptorStatsItem>("descriptors", -1, device);
     addItem<HudMemoryStatsItem>("memory", -1, device);
     addItem<HudMemoryDetailsItem>("allocations", -1, device, &m_renderer);
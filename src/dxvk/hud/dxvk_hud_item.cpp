@@ -642,6 +642,8 @@ namespace dxvk::hud {
       m_dispatchCount   = diffCounters.getCtr(DxvkStatCounter::CmdDispatchCalls);
       m_renderPassCount = diffCounters.getCtr(DxvkStatCounter::CmdRenderPassCount);
       m_barrierCount    = diffCounters.getCtr(DxvkStatCounter::CmdBarrierCount);
+      m_renameCount     = diffCounters.getCtr(DxvkStatCounter::CmdBufferRenameCount);
+      m_renameBytes     = diffCounters.getCtr(DxvkStatCounter::CmdBufferRenameBytes);
 
       m_lastUpdate = time;
     }
@@ -675,6 +677,11 @@ namespace dxvk::hud {
     position.y += 20;
     renderer.drawText(16, position, 0xffff8040, "Barriers:");
     renderer.drawText(16, { position.x + 192, position.y }, 0xffffffffu, str::format(m_barrierCount));
+
+    position.y += 20;
+    renderer.drawText(16, position, 0xffff8040, "Buffer renames:");
+    renderer.drawText(16, { position.x + 192, position.y }, 0xffffffffu,
+      str::format(m_renameCount, " (", m_renameBytes >> 10, " kB)"));
     
     position.y += 8;
     return position;
@@ -698,6 +705,7 @@ namespace dxvk::hud {
     m_graphicsPipelines = counters.getCtr(DxvkStatCounter::PipeCountGraphics);
     m_graphicsLibraries = counters.getCtr(DxvkStatCounter::PipeCountLibrary);
     m_computePipelines  = counters.getCtr(DxvkStatCounter::PipeCountCompute);
+    m_specVariants      = counters.getCtr(DxvkStatCounter::PipeCountSpecVariants);
   }
 
 
@@ -711,6 +719,12 @@ namespace dxvk::hud {
     renderer.drawText(16, position, 0xffff40ff, "Graphics pipelines:");
     renderer.drawText(16, { position.x + 240, position.y }, 0xffffffffu, str::format(m_graphicsPipelines));
 
+    if (m_specVariants) {
+      position.y += 20;
+      renderer.drawText(16, position, 0xffff40ff, "Spec variants:");
+      renderer.drawText(16, { position.x + 240, position.y }, 0xffffffffu, str::format(m_specVariants));
+    }
+
     if (m_graphicsLibraries) {
       position.y += 20;
       renderer.drawText(16, position, 0xffff40ff, "Graphics shaders:");
@@ -726,6 +740,57 @@ namespace dxvk::hud {
   }
 
 
+  HudShaderStatsItem::HudShaderStatsItem(const Rc<DxvkDevice>& device)
+  : m_device(device) {
+
+  }
+
+
+  HudShaderStatsItem::~HudShaderStatsItem() {
+
+  }
+
+
+  void HudShaderStatsItem::update(dxvk::high_resolution_clock::time_point time) {
+    uint64_t ticks = std::chrono::duration_cast<std::chrono::microseconds>(time - m_lastUpdate).count();
+
+    if (ticks < UpdateInterval)
+      return;
+
+    m_shaders = m_device->getShaderStats(MaxShaderCount);
+    m_lastUpdate = time;
+  }
+
+
+  HudPos HudShaderStatsItem::render(
+    const Rc<DxvkCommandList>&ctx,
+    const HudPipelineKey&     key,
+    const HudOptions&         options,
+          HudRenderer&        renderer,
+          HudPos              position) {
+    if (m_shaders.empty())
+      return position;
+
+    position.y += 16;
+    renderer.drawText(16, position, 0xff40ffffu, "Shader cost (ms):");
+
+    for (const auto& entry : m_shaders) {
+      std::string cost = str::format(
+        std::fixed, std::setprecision(2),
+        entry.stats.translationTime / 1000.0, " + ",
+        entry.stats.pipelineTime / 1000.0, " (",
+        entry.stats.pipelineCount, ")");
+
+      position.y += 20;
+      renderer.drawText(16, position, 0xffffffffu, entry.name);
+      renderer.drawText(16, { position.x + 440, position.y }, 0xffffffffu, cost);
+    }
+
+    position.y += 8;
+    return position;
+  }
+
+
   HudDescriptorStatsItem::HudDescriptorStatsItem(const Rc<DxvkDevice>& device)
   : m_device(device) {
 
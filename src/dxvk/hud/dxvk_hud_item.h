@@ -421,6 +421,8 @@ namespace dxvk::hud {
     uint64_t          m_dispatchCount   = 0;
     uint64_t          m_renderPassCount = 0;
     uint64_t          m_barrierCount    = 0;
+    uint64_t          m_renameCount     = 0;
+    uint64_t          m_renameBytes     = 0;
 
     dxvk::high_resolution_clock::time_point m_lastUpdate
       = dxvk::high_resolution_clock::now();
@@ -455,6 +457,39 @@ namespace dxvk::hud {
     uint64_t m_graphicsPipelines  = 0;
     uint64_t m_graphicsLibraries  = 0;
     uint64_t m_computePipelines   = 0;
+    uint64_t m_specVariants       = 0;
+
+  };
+
+
+  /**
+   * \brief HUD item to display the most expensive shaders
+   */
+  class HudShaderStatsItem : public HudItem {
+    constexpr static int64_t UpdateInterval = 500'000;
+    constexpr static uint32_t MaxShaderCount = 5u;
+  public:
+
+    HudShaderStatsItem(const Rc<DxvkDevice>& device);
+
+    ~HudShaderStatsItem();
+
+    void update(dxvk::high_resolution_clock::time_point time);
+
+    HudPos render(
+      const Rc<DxvkCommandList>&ctx,
+      const HudPipelineKey&     key,
+      const HudOptions&         options,
+            HudRenderer&        renderer,
+            HudPos              position);
+
+  private:
+
+    Rc<DxvkDevice> m_device;
+
+    std::vector<DxvkShaderStatsEntry> m_shaders;
+
+    high_resolution_clock::time_point m_lastUpdate = { };
 
   };
 
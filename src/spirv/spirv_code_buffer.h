@@ -57,6 +57,17 @@ namespace dxvk {
     size_t size() const {
       return m_code.size() * sizeof(uint32_t);
     }
+
+    /**
+     * \brief Reserves storage
+     *
+     * Useful to avoid repeated reallocations when
+     * the final size of the code is known up front.
+     * \param [in] dwords Total number of dwords
+     */
+    void reserve(size_t dwords) {
+      m_code.reserve(dwords);
+    }
     
     /**
      * \brief Begin instruction iterator
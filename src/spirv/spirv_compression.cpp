@@ -98,6 +98,31 @@ namespace dxvk {
     while (dstOffset < m_size) {
       uint32_t blockMask = m_code[srcOffset];
 
+      // Fast path for complete blocks that cannot write past the end
+      // of the output even if every DWORD encodes two tokens. This
+      // lets us remove all bounds checks and data-dependent branches
+      // from the inner loop, since writing the second token of a
+      // single-token DWORD is harmless: the next token overwrites it.
+      if (likely(srcOffset + 17 <= m_code.size() && dstOffset + 32 <= m_size)) {
+        const uint32_t* src = &m_code[srcOffset + 1];
+        uint32_t* dst = &data[dstOffset];
+
+        for (uint32_t i = 0; i < 16; i++) {
+          uint32_t schema = (blockMask >> (i << 1)) & 0x3;
+          uint32_t shift  = (shiftAmounts >> (schema << 3)) & 0xff;
+          uint64_t mask   = ~(~0ull << shift);
+          uint64_t encode = src[i];
+
+          dst[0] = encode & mask;
+          dst[1] = encode >> shift;
+          dst += 1 + (schema != 0);
+        }
+
+        dstOffset = dst - data;
+        srcOffset += 17;
+        continue;
+      }
+
       for (uint32_t i = 0; i < 16 && dstOffset < m_size; i++) {
         // Use 64-bit integers for some of the operands so we can
         // shift by 32 bits and not handle it as a special cases
@@ -16,7 +16,24 @@ namespace dxvk {
   
   
   SpirvCodeBuffer SpirvModule::compile() {
+    // Allocate the output once rather than growing it section by
+    // section. Dead code elimination can only shrink the result.
+    constexpr size_t HeaderDwords = 5;
+
     SpirvCodeBuffer result;
+    result.reserve(HeaderDwords
+      + m_capabilities.dwords()
+      + m_extensions.dwords()
+      + m_instExt.dwords()
+      + m_memoryModel.dwords()
+      + m_entryPoints.dwords()
+      + m_execModeInfo.dwords()
+      + m_debugNames.dwords()
+      + m_annotations.dwords()
+      + m_typeConstDefs.dwords()
+      + m_variables.dwords()
+      + m_code.dwords());
+
     result.putHeader(m_version, m_id);
     result.append(m_capabilities);
     result.append(m_extensions);
@@ -3865,22 +3882,14 @@ namespace dxvk {
           spv::Op                 op, 
           uint32_t                argCount,
     const uint32_t*               argIds) {
-    // Since the type info is stored in the code buffer,
-    // we can use the code buffer to look up type IDs as
-    // well. Result IDs are always stored as argument 1.
-    for (auto ins : m_typeConstDefs) {
-      bool match = ins.opCode() == op
-                && ins.length() == 2 + argCount;
-      
-      for (uint32_t i = 0; i < argCount && match; i++)
-        match &= ins.arg(2 + i) == argIds[i];
-      
-      if (match && m_uniqueTypes.find(ins.arg(1)) == m_uniqueTypes.end())
-        return ins.arg(1);
-    }
+    // Look up previously declared types. Unique types are
+    // emitted directly and are therefore never indexed.
+    uint32_t resultId = 0;
+
+    if (lookupDeclaration(op, 0u, argCount, argIds, resultId))
+      return resultId;
     
     // Type not yet declared, create a new one.
-    uint32_t resultId = this->allocateId();
     m_typeConstDefs.putIns (op, 2 + argCount);
     m_typeConstDefs.putWord(resultId);
     
@@ -3890,31 +3899,68 @@ namespace dxvk {
   }
   
   
+  bool SpirvModule::lookupDeclaration(
+          spv::Op                 op,
+          uint32_t                typeId,
+          uint32_t                argCount,
+    const uint32_t*               argIds,
+          uint32_t&               resultId) {
+    // Returns true if a matching declaration exists, otherwise
+    // allocates a new result ID and registers it for the key.
+    if (likely(argCount <= SpirvDeclarationKey::MaxArgCount)) {
+      SpirvDeclarationKey key;
+      key.op = op;
+      key.typeId = typeId;
+      key.argCount = argCount;
+
+      for (uint32_t i = 0; i < argCount; i++)
+        key.argIds[i] = argIds[i];
+
+      auto entry = m_declarations.emplace(key, 0u);
+
+      if (!entry.second) {
+        resultId = entry.first->second;
+        return true;
+      }
+
+      resultId = this->allocateId();
+      entry.first->second = resultId;
+      return false;
+    } else {
+      std::vector<uint32_t> key(2 + argCount);
+      key[0] = uint32_t(op);
+      key[1] = typeId;
+
+      for (uint32_t i = 0; i < argCount; i++)
+        key[2 + i] = argIds[i];
+
+      auto entry = m_largeDeclarations.find(key);
+
+      if (entry != m_largeDeclarations.end()) {
+        resultId = entry->second;
+        return true;
+      }
+
+      resultId = this->allocateId();
+      m_largeDeclarations.emplace(std::move(key), resultId);
+      return false;
+    }
+  }
+
+
   uint32_t SpirvModule::defConst(
           spv::Op                 op,
           uint32_t                typeId,
           uint32_t                argCount,
     const uint32_t*               argIds) {
-    // Avoid declaring constants multiple times
-    for (auto ins : m_typeConstDefs) {
-      bool match = ins.opCode() == op
-                && ins.length() == 3 + argCount
-                && ins.arg(1)   == typeId;
-      
-      for (uint32_t i = 0; i < argCount && match; i++)
-        match &= ins.arg(3 + i) == argIds[i];
-      
-      if (!match)
-        continue;
-      
-      uint32_t id = ins.arg(2);
+    // Avoid declaring constants multiple times. Late constants
+    // may get patched later and are therefore never indexed.
+    uint32_t resultId = 0;
 
-      if (m_lateConsts.find(id) == m_lateConsts.end())
-        return id;
-    }
+    if (lookupDeclaration(op, typeId, argCount, argIds, resultId))
+      return resultId;
     
     // Constant not yet declared, make a new one
-    uint32_t resultId = this->allocateId();
     m_typeConstDefs.putIns (op, 3 + argCount);
     m_typeConstDefs.putWord(typeId);
     m_typeConstDefs.putWord(resultId);
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <array>
 #include <queue>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "spirv_code_buffer.h"
 
+#include "../dxvk/dxvk_hash.h"
+
 namespace dxvk {
   
   struct SpirvPhiLabel {
@@ -41,6 +45,64 @@ namespace dxvk {
     bool     sparse        = false;
   };
 
+  /**
+   * \brief Type or constant declaration key
+   *
+   * Used to look up existing declarations by their opcode,
+   * result type and operands without scanning the code.
+   * Stores operands inline so that lookups do not need to
+   * allocate memory. Declarations with more operands than
+   * fit into the key use the slow path below instead.
+   */
+  struct SpirvDeclarationKey {
+    static constexpr uint32_t MaxArgCount = 6;
+
+    spv::Op   op       = spv::OpNop;
+    uint32_t  typeId   = 0;
+    uint32_t  argCount = 0;
+    std::array<uint32_t, MaxArgCount> argIds = { };
+
+    bool eq(const SpirvDeclarationKey& other) const {
+      bool eq = op       == other.op
+             && typeId   == other.typeId
+             && argCount == other.argCount;
+
+      for (uint32_t i = 0; i < argCount && eq; i++)
+        eq = argIds[i] == other.argIds[i];
+
+      return eq;
+    }
+
+    size_t hash() const {
+      DxvkHashState hash;
+      hash.add(uint32_t(op));
+      hash.add(typeId);
+      hash.add(argCount);
+
+      for (uint32_t i = 0; i < argCount; i++)
+        hash.add(argIds[i]);
+
+      return hash;
+    }
+  };
+
+  /**
+   * \brief Hash for large type and constant declarations
+   *
+   * Used for declarations whose operands
+   * do not fit into \ref SpirvDeclarationKey.
+   */
+  struct SpirvDeclarationHash {
+    size_t operator () (const std::vector<uint32_t>& words) const {
+      DxvkHashState hash;
+
+      for (uint32_t word : words)
+        hash.add(word);
+
+      return hash;
+    }
+  };
+
   constexpr uint32_t spvVersion(uint32_t major, uint32_t minor) {
     return (major << 16) | (minor << 8);
   }
@@ -1311,6 +1373,11 @@ namespace dxvk {
     std::unordered_set<uint32_t> m_uniqueTypes;
     std::unordered_set<uint32_t> m_lateConsts;
 
+    std::unordered_map<SpirvDeclarationKey, uint32_t,
+      DxvkHash, DxvkEq> m_declarations;
+    std::unordered_map<std::vector<uint32_t>, uint32_t,
+      SpirvDeclarationHash> m_largeDeclarations;
+
     std::vector<uint32_t> m_interfaceVars;
 
     uint32_t defType(
@@ -1318,6 +1385,13 @@ namespace dxvk {
             uint32_t                argCount,
       const uint32_t*               argIds);
     
+    bool lookupDeclaration(
+            spv::Op                 op,
+            uint32_t                typeId,
+            uint32_t                argCount,
+      const uint32_t*               argIds,
+            uint32_t&               resultId);
+
     uint32_t defConst(
             spv::Op                 op,
             uint32_t                typeId,
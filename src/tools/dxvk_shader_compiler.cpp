@@ -0,0 +1,530 @@
+// Needed for spv::HasResultAndType, must be
+// defined before the SPIR-V headers are included
+#define SPV_ENABLE_UTILITY_CODE
+
+#include <algorithm>
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../d3d9/d3d9_caps.h"
+#include "../d3d9/d3d9_options.h"
+
+#include "../d3d11/d3d11_options.h"
+
+#include "../dxbc/dxbc_module.h"
+
+#include "../dxso/dxso_modinfo.h"
+#include "../dxso/dxso_module.h"
+
+#include "../dxvk/dxvk_options.h"
+
+#include "../util/config/config.h"
+#include "../util/thread.h"
+#include "../util/util_string.h"
+#include "../util/util_time.h"
+
+namespace dxvk {
+
+  /**
+   * \brief Shader blob type
+   */
+  enum class ShaderBlobType : uint32_t {
+    Dxbc,
+    Dxso,
+  };
+
+
+  /**
+   * \brief Shader blob
+   *
+   * A single dumped shader. The name is the file name
+   * without extension, i.e. the shader key as printed
+   * by the D3D front-ends when dumping shaders.
+   */
+  struct ShaderBlob {
+    std::string       name;
+    ShaderBlobType    type;
+    std::vector<char> data;
+  };
+
+
+  /**
+   * \brief Per-shader results
+   *
+   * Translation time is accumulated over all iterations.
+   */
+  struct ShaderResult {
+    size_t      spirvSize = 0;
+    uint64_t    time      = 0;
+    bool        failed    = false;
+    std::string error;
+  };
+
+
+  /**
+   * \brief Command line arguments
+   */
+  struct ShaderCompilerArgs {
+    std::string inputPath;
+    std::string outputPath;
+    std::string appName;
+    uint32_t    threadCount = 0;
+    uint32_t    iterations  = 1;
+    bool        validate    = false;
+  };
+
+
+  /**
+   * \brief Offline shader compiler
+   *
+   * Translates DXBC and DXSO shaders to SPIR-V using the same
+   * modules and option sets as the D3D11 and D3D9 front-ends.
+   * Options that depend on Vulkan device features cannot be
+   * queried without a device and use conservative defaults.
+   */
+  class ShaderCompiler {
+
+  public:
+
+    ShaderCompiler(const Config& config) {
+      D3D11Options d3d11Options(config);
+      D3D9Options  d3d9Options(nullptr, config);
+      DxvkOptions  dxvkOptions(config);
+
+      DxbcOptions& dxbc = m_dxbcInfo.options;
+      dxbc.invariantPosition        = d3d11Options.invariantPosition;
+      dxbc.forceVolatileTgsmAccess  = d3d11Options.forceVolatileTgsmAccess;
+      dxbc.forceComputeUavBarriers  = d3d11Options.forceComputeUavBarriers;
+      dxbc.disableMsaa              = d3d11Options.disableMsaa;
+      dxbc.forceSampleRateShading   = d3d11Options.forceSampleRateShading;
+      dxbc.sincosEmulation          = d3d11Options.sincosEmulation == Tristate::True;
+
+      switch (dxvkOptions.useRawSsbo) {
+        case Tristate::Auto:  dxbc.minSsboAlignment = 16u; break;
+        case Tristate::True:  dxbc.minSsboAlignment =  4u; break;
+        case Tristate::False: dxbc.minSsboAlignment = ~0u; break;
+      }
+
+      m_dxbcInfo.tess = nullptr;
+      m_dxbcInfo.xfb  = nullptr;
+
+      m_tessInfo.maxTessFactor = float(d3d11Options.maxTessFactor);
+
+      if (m_tessInfo.maxTessFactor >= 8.0f)
+        m_dxbcInfo.tess = &m_tessInfo;
+
+      m_vsLayout.floatCount   = caps::MaxFloatConstantsVS;
+      m_vsLayout.intCount     = caps::MaxOtherConstants;
+      m_vsLayout.boolCount    = caps::MaxOtherConstants;
+      m_vsLayout.bitmaskCount = align(m_vsLayout.boolCount, 32) / 32;
+
+      m_psLayout.floatCount   = caps::MaxFloatConstantsPS;
+      m_psLayout.intCount     = caps::MaxOtherConstants;
+      m_psLayout.boolCount    = caps::MaxOtherConstants;
+      m_psLayout.bitmaskCount = align(m_psLayout.boolCount, 32) / 32;
+
+      DxsoOptions& dxso = m_dxsoInfo.options;
+      dxso.strictConstantCopies           = d3d9Options.strictConstantCopies;
+      dxso.d3d9FloatEmulation             = d3d9Options.d3d9FloatEmulation;
+      dxso.strictPow                      = d3d9Options.strictPow;
+      dxso.invariantPosition              = d3d9Options.invariantPosition;
+      dxso.forceSamplerTypeSpecConstants  = d3d9Options.forceSamplerTypeSpecConstants;
+      dxso.forceSampleRateShading         = d3d9Options.forceSampleRateShading;
+      dxso.vertexFloatConstantBufferAsSSBO = false;
+      dxso.robustness2Supported           = true;
+      dxso.sincosEmulation                = d3d9Options.sincosEmulation;
+      dxso.drefScaling                    = d3d9Options.drefScaling;
+    }
+
+    Rc<DxvkShader> compile(const ShaderBlob& blob) const {
+      switch (blob.type) {
+        case ShaderBlobType::Dxbc: return compileDxbc(blob);
+        case ShaderBlobType::Dxso: return compileDxso(blob);
+      }
+
+      throw DxvkError("Unknown shader type");
+    }
+
+  private:
+
+    DxbcModuleInfo      m_dxbcInfo = { };
+    DxbcTessInfo        m_tessInfo = { };
+
+    DxsoModuleInfo      m_dxsoInfo = { };
+    D3D9ConstantLayout  m_vsLayout = { };
+    D3D9ConstantLayout  m_psLayout = { };
+
+    Rc<DxvkShader> compileDxbc(const ShaderBlob& blob) const {
+      DxbcReader reader(blob.data.data(), blob.data.size());
+      DxbcModule module(reader);
+
+      if (!module.programInfo())
+        throw DxvkError("Invalid shader binary");
+
+      return module.compile(m_dxbcInfo, blob.name);
+    }
+
+    Rc<DxvkShader> compileDxso(const ShaderBlob& blob) const {
+      DxsoReader reader(blob.data.data());
+      DxsoModule module(reader);
+
+      DxsoAnalysisInfo analysis = module.analyze();
+
+      if (analysis.bytecodeByteLength > blob.data.size())
+        throw DxvkError("Truncated shader binary");
+
+      const D3D9ConstantLayout& layout = module.info().shaderStage() == VK_SHADER_STAGE_VERTEX_BIT
+        ? m_vsLayout
+        : m_psLayout;
+
+      return module.compile(m_dxsoInfo, blob.name, analysis, layout);
+    }
+
+  };
+
+
+  /**
+   * \brief Checks generated SPIR-V for structural errors
+   *
+   * Verifies the module header, instruction lengths, and
+   * that every result ID is within bounds and unique.
+   * \param [in] code SPIR-V code
+   * \param [out] error Error message
+   * \returns \c true if the module is well-formed
+   */
+  static bool validateSpirv(const SpirvCodeBuffer& code, std::string& error) {
+    const uint32_t* words = code.data();
+    const uint32_t  count = code.dwords();
+
+    if (count < 5u || words[0] != spv::MagicNumber) {
+      error = "Invalid SPIR-V header";
+      return false;
+    }
+
+    std::vector<bool> defined(words[3], false);
+
+    uint32_t entryPointCount  = 0u;
+    uint32_t memoryModelCount = 0u;
+
+    for (uint32_t offset = 5u; offset < count; ) {
+      uint32_t length = words[offset] >> spv::WordCountShift;
+      auto     op     = spv::Op(words[offset] & spv::OpCodeMask);
+
+      if (!length || offset + length > count) {
+        error = str::format("Invalid instruction length at word ", offset);
+        return false;
+      }
+
+      bool hasResult = false;
+      bool hasResultType = false;
+      spv::HasResultAndType(op, &hasResult, &hasResultType);
+
+      if (hasResult) {
+        uint32_t index = hasResultType ? 2u : 1u;
+        uint32_t id = index < length ? words[offset + index] : 0u;
+
+        if (!id || id >= defined.size()) {
+          error = str::format("Result ID ", id, " out of bounds at word ", offset);
+          return false;
+        }
+
+        if (defined[id]) {
+          error = str::format("Result ID ", id, " defined more than once");
+          return false;
+        }
+
+        defined[id] = true;
+      }
+
+      entryPointCount  += op == spv::OpEntryPoint  ? 1u : 0u;
+      memoryModelCount += op == spv::OpMemoryModel ? 1u : 0u;
+
+      offset += length;
+    }
+
+    if (!entryPointCount || memoryModelCount != 1u) {
+      error = "Missing entry point or memory model";
+      return false;
+    }
+
+    return true;
+  }
+
+
+  static std::vector<ShaderBlob> loadShaders(const std::string& path) {
+    std::vector<ShaderBlob> result;
+
+    for (const auto& entry : std::filesystem::directory_iterator(path)) {
+      if (!entry.is_regular_file())
+        continue;
+
+      std::string extension = entry.path().extension().string();
+
+      ShaderBlob blob;
+
+      if (extension == ".dxbc")
+        blob.type = ShaderBlobType::Dxbc;
+      else if (extension == ".dxso")
+        blob.type = ShaderBlobType::Dxso;
+      else
+        continue;
+
+      blob.name = entry.path().stem().string();
+      blob.data.resize(entry.file_size());
+
+      std::ifstream file(entry.path(), std::ios_base::binary);
+
+      if (!file.read(blob.data.data(), blob.data.size())) {
+        Logger::err(str::format("Failed to read ", entry.path().string()));
+        continue;
+      }
+
+      result.push_back(std::move(blob));
+    }
+
+    // Keep output and work distribution deterministic
+    std::sort(result.begin(), result.end(),
+      [] (const ShaderBlob& a, const ShaderBlob& b) {
+        return a.name < b.name;
+      });
+
+    return result;
+  }
+
+
+  static void compileShaders(
+    const ShaderCompilerArgs&         args,
+    const ShaderCompiler&             compiler,
+    const std::vector<ShaderBlob>&    blobs,
+          std::vector<ShaderResult>&  results) {
+    // Each work item is one shader in one iteration. Only the first
+    // iteration of each shader writes its result, later iterations
+    // only record their translation time in a separate slot.
+    const size_t itemCount = blobs.size() * args.iterations;
+
+    std::vector<uint64_t> times(itemCount);
+    std::atomic<size_t> nextItem = { 0u };
+
+    auto worker = [&] {
+      size_t item;
+
+      while ((item = nextItem++) < itemCount) {
+        const size_t index = item % blobs.size();
+        const bool   first = item < blobs.size();
+
+        const ShaderBlob&   blob   = blobs[index];
+              ShaderResult& result = results[index];
+
+        try {
+          auto t0 = dxvk::high_resolution_clock::now();
+          Rc<DxvkShader> shader = compiler.compile(blob);
+          auto t1 = dxvk::high_resolution_clock::now();
+
+          times[item] = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+
+          if (!first)
+            continue;
+
+          SpirvCodeBuffer code = shader->getRawCode();
+          result.spirvSize = code.size();
+
+          if (args.validate && !validateSpirv(code, result.error))
+            result.failed = true;
+
+          if (!args.outputPath.empty()) {
+            std::ofstream file(str::topath(str::format(args.outputPath, "/", blob.name, ".spv").c_str()).c_str(),
+              std::ios_base::binary | std::ios_base::trunc);
+            code.store(file);
+          }
+        } catch (const DxvkError& e) {
+          if (first) {
+            result.failed = true;
+            result.error  = e.message();
+          }
+        }
+      }
+    };
+
+    std::vector<dxvk::thread> threads;
+
+    for (uint32_t i = 1; i < args.threadCount; i++)
+      threads.emplace_back(worker);
+
+    worker();
+
+    for (auto& thread : threads)
+      thread.join();
+
+    for (size_t i = 0; i < itemCount; i++)
+      results[i % blobs.size()].time += times[i];
+  }
+
+
+  static void printResults(
+    const ShaderCompilerArgs&         args,
+    const std::vector<ShaderBlob>&    blobs,
+    const std::vector<ShaderResult>&  results,
+          uint64_t                    wallTime) {
+    size_t dxbcCount = 0;
+    size_t dxsoCount = 0;
+    size_t failCount = 0;
+
+    size_t bytecodeSize = 0;
+    size_t spirvSize = 0;
+
+    uint64_t translationTime = 0;
+
+    for (size_t i = 0; i < blobs.size(); i++) {
+      if (results[i].failed) {
+        std::cout << blobs[i].name << ": " << results[i].error << std::endl;
+        failCount += 1;
+      }
+
+      dxbcCount += blobs[i].type == ShaderBlobType::Dxbc ? 1 : 0;
+      dxsoCount += blobs[i].type == ShaderBlobType::Dxso ? 1 : 0;
+
+      bytecodeSize    += blobs[i].data.size();
+      spirvSize       += results[i].spirvSize;
+      translationTime += results[i].time;
+    }
+
+    size_t   shaderCount = blobs.size() * args.iterations;
+    double   seconds     = double(std::max<uint64_t>(wallTime, 1u)) / 1000000.0;
+    double   mib         = double(1u << 20);
+
+    std::cout << "Shaders:     " << blobs.size() << " (DXBC: " << dxbcCount << ", DXSO: " << dxsoCount << "), " << failCount << " failed" << std::endl;
+    std::cout << "Threads:     " << args.threadCount << ", iterations: " << args.iterations << std::endl;
+    std::cout << "Wall time:   " << (wallTime / 1000u) << " ms" << std::endl;
+    std::cout << "Throughput:  " << uint64_t(double(shaderCount) / seconds) << " shaders/s, "
+      << (double(bytecodeSize * args.iterations) / mib / seconds) << " MiB/s bytecode, "
+      << (double(spirvSize * args.iterations) / mib / seconds) << " MiB/s SPIR-V" << std::endl;
+    std::cout << "Translation: " << (translationTime / 1000u) << " ms total, "
+      << (translationTime / std::max<size_t>(shaderCount, 1u)) << " us per shader" << std::endl;
+
+    // List the most expensive shaders to help find outliers
+    std::vector<size_t> order(blobs.size());
+
+    for (size_t i = 0; i < order.size(); i++)
+      order[i] = i;
+
+    size_t slowCount = std::min<size_t>(order.size(), 10u);
+
+    std::partial_sort(order.begin(), order.begin() + slowCount, order.end(),
+      [&] (size_t a, size_t b) {
+        return results[a].time > results[b].time;
+      });
+
+    if (slowCount)
+      std::cout << "Slowest shaders:" << std::endl;
+
+    for (size_t i = 0; i < slowCount; i++) {
+      const size_t index = order[i];
+
+      std::cout << "  " << blobs[index].name << ": "
+        << (results[index].time / args.iterations) << " us" << std::endl;
+    }
+  }
+
+
+  static void printUsage(const char* name) {
+    std::cout << "Usage: " << name << " [options] <directory>" << std::endl
+      << "Translates all .dxbc and .dxso files in the given directory, as written" << std::endl
+      << "by DXVK_SHADER_DUMP_PATH, and reports translation throughput." << std::endl
+      << std::endl
+      << "Options:" << std::endl
+      << "  -j, --threads <n>      Number of worker threads (default: all cores)" << std::endl
+      << "  -n, --iterations <n>   Translate each shader n times (default: 1)" << std::endl
+      << "  -a, --app <name>       Apply built-in options for the given executable" << std::endl
+      << "  -o, --output <dir>     Write the generated SPIR-V to the given directory" << std::endl
+      << "  -v, --validate         Check the generated SPIR-V for structural errors" << std::endl
+      << "  -h, --help             Show this message" << std::endl;
+  }
+
+
+  static bool parseArgs(int argc, char** argv, ShaderCompilerArgs& args) {
+    for (int i = 1; i < argc; i++) {
+      std::string arg = argv[i];
+
+      bool hasValue = i + 1 < argc;
+
+      if ((arg == "-j" || arg == "--threads") && hasValue) {
+        args.threadCount = std::stoul(argv[++i]);
+      } else if ((arg == "-n" || arg == "--iterations") && hasValue) {
+        args.iterations = std::max(1ul, std::stoul(argv[++i]));
+      } else if ((arg == "-a" || arg == "--app") && hasValue) {
+        args.appName = argv[++i];
+      } else if ((arg == "-o" || arg == "--output") && hasValue) {
+        args.outputPath = argv[++i];
+      } else if (arg == "-v" || arg == "--validate") {
+        args.validate = true;
+      } else if (arg.size() && arg[0] != '-' && args.inputPath.empty()) {
+        args.inputPath = arg;
+      } else {
+        return false;
+      }
+    }
+
+    if (!args.threadCount)
+      args.threadCount = std::max(dxvk::thread::hardware_concurrency(), 1u);
+
+    return !args.inputPath.empty();
+  }
+
+}
+
+
+int main(int argc, char** argv) {
+  using namespace dxvk;
+
+  ShaderCompilerArgs args;
+
+  if (!parseArgs(argc, argv, args)) {
+    printUsage(argv[0]);
+    return 1;
+  }
+
+  try {
+    Config config = Config::getUserConfig();
+
+    if (!args.appName.empty())
+      config.merge(Config::getAppConfig(args.appName));
+
+    config.logOptions();
+
+    ShaderCompiler compiler(config);
+
+    std::vector<ShaderBlob> blobs = loadShaders(args.inputPath);
+
+    if (blobs.empty()) {
+      std::cout << "No shaders found in " << args.inputPath << std::endl;
+      return 1;
+    }
+
+    if (!args.outputPath.empty())
+      std::filesystem::create_directories(args.outputPath);
+
+    std::vector<ShaderResult> results(blobs.size());
+
+    auto t0 = dxvk::high_resolution_clock::now();
+    compileShaders(args, compiler, blobs, results);
+    auto t1 = dxvk::high_resolution_clock::now();
+
+    printResults(args, blobs, results,
+      std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
+
+    bool failed = std::any_of(results.begin(), results.end(),
+      [] (const ShaderResult& r) { return r.failed; });
+
+    return failed ? 1 : 0;
+  } catch (const std::exception& e) {
+    std::cerr << e.what() << std::endl;
+    return 1;
+  } catch (const DxvkError& e) {
+    std::cerr << e.message() << std::endl;
+    return 1;
+  }
+}